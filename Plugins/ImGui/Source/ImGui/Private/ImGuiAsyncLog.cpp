@@ -0,0 +1,218 @@
+// Distributed under the MIT License (MIT) (see accompanying LICENSE file)
+
+
+#include "ImGuiAsyncLog.h"
+
+#include "HAL/FileManager.h"
+#include "HAL/RunnableThread.h"
+#include "Misc/CoreDelegates.h"
+#include "Misc/Paths.h"
+
+#include <imgui_internal.h>
+#include <stdio.h>
+
+FImGuiAsyncLog& FImGuiAsyncLog::Get()
+{
+	static FImGuiAsyncLog Instance;
+	return Instance;
+}
+
+FImGuiAsyncLog::FImGuiAsyncLog()
+{
+	WorkEvent = FPlatformProcess::GetSynchEventFromPool();
+
+	// the writer must be done before statics are torn down
+	PreExitHandle = FCoreDelegates::OnPreExit.AddRaw(this, &FImGuiAsyncLog::Stop);
+}
+
+FImGuiAsyncLog::~FImGuiAsyncLog()
+{
+	// on module unload the delegate outlives this instance
+	FCoreDelegates::OnPreExit.Remove(PreExitHandle);
+	Stop();
+	FPlatformProcess::ReturnSynchEventToPool(WorkEvent);
+	WorkEvent = nullptr;
+}
+
+void FImGuiAsyncLog::Begin(const FString& Filename, int32 AutoOpenDepth)
+{
+	ImGuiContext* Context = ImGui::GetCurrentContext();
+	if (Context == nullptr || Context->LogEnabled)
+		return;
+
+	ImGui::LogBegin(ImGuiLogType_Buffer, AutoOpenDepth);
+	Captures.Add(Context, Filename);
+}
+
+void FImGuiAsyncLog::LogToFile(const FString& Filename, int32 AutoOpenDepth)
+{
+	if (!Filename.IsEmpty())
+	{
+		Begin(Filename, AutoOpenDepth);
+	}
+	else if (ImGui::GetCurrentContext() && ImGui::GetIO().LogFilename)
+	{
+		Begin(UTF8_TO_TCHAR(ImGui::GetIO().LogFilename), AutoOpenDepth);
+	}
+}
+
+void FImGuiAsyncLog::LogToTTY(int32 AutoOpenDepth)
+{
+	Begin(FString(), AutoOpenDepth);
+}
+
+bool FImGuiAsyncLog::IsCapturing() const
+{
+	return Captures.Contains(ImGui::GetCurrentContext());
+}
+
+void FImGuiAsyncLog::Submit(const FString& Filename, bool bClose)
+{
+	ImGuiTextBuffer& Buffer = GImGui->LogBuffer;
+	const int32 Size = Buffer.size();
+
+	TUniquePtr<FJob> Job = MakeUnique<FJob>();
+	Job->Filename = Filename;
+	Job->bClose = bClose;
+	if (Size > 0)
+	{
+		if (PendingBytes.GetValue() + Size > MaxPendingBytes)
+		{
+			// the disk is behind: drop rather than grow or wait
+			DroppedChunks.Increment();
+		}
+		else
+		{
+			Job->Text.Append(Buffer.begin(), Size);
+			PendingBytes.Add(Size);
+		}
+		Buffer.clear();
+	}
+	if (Job->Text.Num() == 0 && !bClose)
+		return;
+
+	if (Thread == nullptr && !bStopping)
+	{
+		Thread = FRunnableThread::Create(this, TEXT("ImGuiLogWriter"), 0, TPri_BelowNormal);
+	}
+	if (Thread == nullptr)
+	{
+		PendingBytes.Subtract(Job->Text.Num());
+		if (Job->Text.Num() > 0)
+		{
+			DroppedChunks.Increment();
+		}
+		return;
+	}
+
+	Jobs.Enqueue(MoveTemp(Job));
+	WorkEvent->Trigger();
+}
+
+void FImGuiAsyncLog::Flush()
+{
+	ImGuiContext* Context = ImGui::GetCurrentContext();
+	const FString* Filename = Captures.Find(Context);
+	if (Filename && Context->LogEnabled && Context->LogType == ImGuiLogType_Buffer)
+	{
+		Submit(*Filename, false);
+	}
+}
+
+void FImGuiAsyncLog::LogFinish()
+{
+	ImGuiContext* Context = ImGui::GetCurrentContext();
+	if (Context == nullptr)
+		return;
+
+	FString Filename;
+	if (Captures.RemoveAndCopyValue(Context, Filename))
+	{
+		// ImGui ends a capture with a new line, the buffer is cleared by LogFinish below
+		if (Context->LogEnabled && Context->LogType == ImGuiLogType_Buffer)
+		{
+			ImGui::LogText(IM_NEWLINE);
+		}
+		Submit(Filename, true);
+	}
+	ImGui::LogFinish();
+}
+
+void FImGuiAsyncLog::Stop()
+{
+	if (Thread == nullptr)
+		return;
+
+	bStopping = true;
+	WorkEvent->Trigger();
+	Thread->WaitForCompletion();
+	delete Thread;
+	Thread = nullptr;
+}
+
+void FImGuiAsyncLog::Write(TMap<FString, TUniquePtr<FArchive>>& Files, FJob& Job)
+{
+	const int32 Size = Job.Text.Num();
+	if (Size > 0)
+	{
+		if (Job.Filename.IsEmpty())
+		{
+			fwrite(Job.Text.GetData(), 1, Size, stdout);
+			fflush(stdout);
+		}
+		else
+		{
+			TUniquePtr<FArchive>* File = Files.Find(Job.Filename);
+			if (File == nullptr)
+			{
+				// appended like ImGui does, a file that cannot be opened is not retried before its capture ends
+				IFileManager::Get().MakeDirectory(*FPaths::GetPath(Job.Filename), true);
+				File = &Files.Add(Job.Filename, TUniquePtr<FArchive>(IFileManager::Get().CreateFileWriter(*Job.Filename, FILEWRITE_Append | FILEWRITE_AllowRead)));
+				if (!File->IsValid())
+				{
+					UE_LOG(LogTemp, Warning, TEXT("ImGui: cannot open log file '%s' for writing."), *Job.Filename);
+				}
+			}
+			if (File->IsValid())
+			{
+				(*File)->Serialize(Job.Text.GetData(), Size);
+			}
+		}
+		PendingBytes.Subtract(Size);
+		WrittenBytes.Add(Size);
+	}
+
+	if (Job.bClose)
+	{
+		Files.Remove(Job.Filename);
+	}
+}
+
+uint32 FImGuiAsyncLog::Run()
+{
+	TMap<FString, TUniquePtr<FArchive>> Files;
+	for (;;)
+	{
+		const bool bWasStopping = bStopping;
+
+		TUniquePtr<FJob> Job;
+		while (Jobs.Dequeue(Job))
+		{
+			Write(Files, *Job);
+		}
+
+		// everything queued before the stop request has been written
+		if (bWasStopping)
+			break;
+
+		for (TPair<FString, TUniquePtr<FArchive>>& File : Files)
+		{
+			if (File.Value.IsValid())
+			{
+				File.Value->Flush();
+			}
+		}
+		WorkEvent->Wait(100);
+	}
+	return 0;
+}
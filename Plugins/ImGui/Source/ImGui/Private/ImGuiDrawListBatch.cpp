@@ -0,0 +1,306 @@
+// Distributed under the MIT License (MIT) (see accompanying LICENSE file)
+
+
+#include "ImGuiDrawListBatch.h"
+
+#include <imgui_internal.h>
+
+static_assert(sizeof(FVector2D) == sizeof(ImVec2), "FVector2D arrays are passed to ImGui as ImVec2 arrays");
+
+namespace
+{
+	// width of the transparent edge added to anti-aliased primitives, as in ImDrawList
+	constexpr float FringeSize = 1.0f;
+
+	FORCEINLINE ImVec2 ToVec(const FVector2D& V)
+	{
+		return ImVec2(V.X, V.Y);
+	}
+
+	FORCEINLINE ImU32 GetColor(const ImU32* Colors, int32 NumColors, int32 Index)
+	{
+		return Colors[FMath::Min(Index, NumColors - 1)];
+	}
+
+	FORCEINLINE ImU32 Transparent(ImU32 Color)
+	{
+		return Color & ~IM_COL32_A_MASK;
+	}
+
+	// Writes #NumItems items of #VtxPerItem vertices and #IdxPerItem indices. Everything is reserved at once,
+	// unless 16 bit indices force a new vertex offset every 64K vertices.
+	template<typename WriterType>
+	void WriteItems(ImDrawList* DrawList, int32 NumItems, int32 VtxPerItem, int32 IdxPerItem, WriterType Writer)
+	{
+		const int32 MaxItems = sizeof(ImDrawIdx) == 2 ? FMath::Max(1, 0xFFFF / VtxPerItem) : NumItems;
+		for (int32 First = 0; First < NumItems; First += MaxItems)
+		{
+			const int32 Count = FMath::Min(MaxItems, NumItems - First);
+			DrawList->PrimReserve(Count * IdxPerItem, Count * VtxPerItem);
+			for (int32 i = First; i < First + Count; ++i)
+			{
+				Writer(i);
+			}
+		}
+	}
+
+	FORCEINLINE void WriteVtx(ImDrawList* DrawList, const ImVec2& Pos, const ImVec2& Uv, ImU32 Color)
+	{
+		ImDrawVert* Vtx = DrawList->_VtxWritePtr++;
+		Vtx->pos = Pos;
+		Vtx->uv = Uv;
+		Vtx->col = Color;
+	}
+
+	// Two triangles over the quad a, b, c, d (relative to #Base).
+	FORCEINLINE void WriteQuadIdx(ImDrawList* DrawList, ImDrawIdx Base, int32 A, int32 B, int32 C, int32 D)
+	{
+		ImDrawIdx* Idx = DrawList->_IdxWritePtr;
+		Idx[0] = (ImDrawIdx)(Base + A); Idx[1] = (ImDrawIdx)(Base + B); Idx[2] = (ImDrawIdx)(Base + C);
+		Idx[3] = (ImDrawIdx)(Base + A); Idx[4] = (ImDrawIdx)(Base + C); Idx[5] = (ImDrawIdx)(Base + D);
+		DrawList->_IdxWritePtr += 6;
+	}
+
+	int32 GetCircleSegments(const ImDrawList* DrawList, float MaxRadius, int32 NumSegments)
+	{
+		if (NumSegments > 0)
+			return FMath::Clamp(NumSegments, 3, 512);
+
+		// same error bound as ImDrawList's automatic segment count
+		const float MaxError = FMath::Max(0.01f, DrawList->_Data->CircleSegmentMaxError);
+		if (MaxRadius <= MaxError)
+			return 12;
+		const float Segments = PI / FMath::Acos(1.0f - MaxError / MaxRadius);
+		return FMath::Clamp(FMath::CeilToInt(Segments), 12, 512);
+	}
+}
+
+ImDrawList* FImGuiDrawListBatch::GetDrawList(EImGuiDrawList Target)
+{
+	switch (Target)
+	{
+	case EImGuiDrawList::Background: return ImGui::GetBackgroundDrawList();
+	case EImGuiDrawList::Foreground: return ImGui::GetForegroundDrawList();
+	default:                         return ImGui::GetWindowDrawList();
+	}
+}
+
+void FImGuiDrawListBatch::AddPolyline(ImDrawList* DrawList, const FVector2D* Points, int32 Count, ImU32 Color, bool bClosed, float Thickness)
+{
+	// ImDrawList already reserves the whole polyline at once and writes it in place
+	if (DrawList != nullptr && Count >= 2)
+	{
+		DrawList->AddPolyline(reinterpret_cast<const ImVec2*>(Points), Count, Color, bClosed, Thickness);
+	}
+}
+
+void FImGuiDrawListBatch::AddConvexPolyFilled(ImDrawList* DrawList, const FVector2D* Points, int32 Count, ImU32 Color)
+{
+	if (DrawList != nullptr && Count >= 3)
+	{
+		DrawList->AddConvexPolyFilled(reinterpret_cast<const ImVec2*>(Points), Count, Color);
+	}
+}
+
+void FImGuiDrawListBatch::AddLines(ImDrawList* DrawList, const FVector2D* Points, int32 NumLines, const ImU32* Colors, int32 NumColors, float Thickness)
+{
+	if (DrawList == nullptr || NumLines <= 0 || NumColors <= 0)
+		return;
+
+	const ImVec2 Uv = DrawList->_Data->TexUvWhitePixel;
+	const bool bAntiAliased = (DrawList->Flags & ImDrawListFlags_AntiAliasedLines) != 0;
+
+	// anti-aliased: core quad plus a transparent fringe on each side (8 vertices, 3 quads)
+	const float Core = bAntiAliased ? FMath::Max(0.0f, Thickness - FringeSize) * 0.5f : Thickness * 0.5f;
+	const float Outer = Core + FringeSize;
+
+	WriteItems(DrawList, NumLines, bAntiAliased ? 8 : 4, bAntiAliased ? 18 : 6, [&](int32 i)
+	{
+		const ImVec2 A = ToVec(Points[2 * i]);
+		const ImVec2 B = ToVec(Points[2 * i + 1]);
+		const ImU32 Color = GetColor(Colors, NumColors, i);
+
+		ImVec2 Dir(B.x - A.x, B.y - A.y);
+		const float LengthSq = Dir.x * Dir.x + Dir.y * Dir.y;
+		if (LengthSq > 0.0f)
+		{
+			const float InvLength = FMath::InvSqrt(LengthSq);
+			Dir.x *= InvLength;
+			Dir.y *= InvLength;
+		}
+		const ImVec2 Normal(-Dir.y, Dir.x);
+
+		const ImDrawIdx Base = (ImDrawIdx)DrawList->_VtxCurrentIdx;
+		if (bAntiAliased)
+		{
+			const float Offsets[4] = { Outer, Core, -Core, -Outer };
+			for (const ImVec2& P : { A, B })
+			{
+				for (int32 k = 0; k < 4; ++k)
+				{
+					const ImVec2 Pos(P.x + Normal.x * Offsets[k], P.y + Normal.y * Offsets[k]);
+					WriteVtx(DrawList, Pos, Uv, k == 0 || k == 3 ? Transparent(Color) : Color);
+				}
+			}
+			WriteQuadIdx(DrawList, Base, 0, 1, 5, 4);
+			WriteQuadIdx(DrawList, Base, 1, 2, 6, 5);
+			WriteQuadIdx(DrawList, Base, 2, 3, 7, 6);
+			DrawList->_VtxCurrentIdx += 8;
+		}
+		else
+		{
+			WriteVtx(DrawList, ImVec2(A.x + Normal.x * Core, A.y + Normal.y * Core), Uv, Color);
+			WriteVtx(DrawList, ImVec2(B.x + Normal.x * Core, B.y + Normal.y * Core), Uv, Color);
+			WriteVtx(DrawList, ImVec2(B.x - Normal.x * Core, B.y - Normal.y * Core), Uv, Color);
+			WriteVtx(DrawList, ImVec2(A.x - Normal.x * Core, A.y - Normal.y * Core), Uv, Color);
+			WriteQuadIdx(DrawList, Base, 0, 1, 2, 3);
+			DrawList->_VtxCurrentIdx += 4;
+		}
+	});
+}
+
+void FImGuiDrawListBatch::AddRects(ImDrawList* DrawList, const FVector2D* Corners, int32 NumRects, const ImU32* Colors, int32 NumColors, float Thickness, bool bFilled)
+{
+	if (DrawList == nullptr || NumRects <= 0 || NumColors <= 0)
+		return;
+
+	const ImVec2 Uv = DrawList->_Data->TexUvWhitePixel;
+
+	if (bFilled)
+	{
+		// axis aligned, so no fringe needed (same as ImDrawList::AddRectFilled without rounding)
+		WriteItems(DrawList, NumRects, 4, 6, [&](int32 i)
+		{
+			const FVector2D& Min = Corners[2 * i];
+			const FVector2D& Max = Corners[2 * i + 1];
+			const ImU32 Color = GetColor(Colors, NumColors, i);
+			const ImDrawIdx Base = (ImDrawIdx)DrawList->_VtxCurrentIdx;
+			WriteVtx(DrawList, ImVec2(Min.X, Min.Y), Uv, Color);
+			WriteVtx(DrawList, ImVec2(Max.X, Min.Y), Uv, Color);
+			WriteVtx(DrawList, ImVec2(Max.X, Max.Y), Uv, Color);
+			WriteVtx(DrawList, ImVec2(Min.X, Max.Y), Uv, Color);
+			WriteQuadIdx(DrawList, Base, 0, 1, 2, 3);
+			DrawList->_VtxCurrentIdx += 4;
+		});
+		return;
+	}
+
+	// outline as a ring of 4 quads between an outer and an inner rect, centered on the pixel edges like AddRect
+	const float Half = Thickness * 0.5f;
+	WriteItems(DrawList, NumRects, 8, 24, [&](int32 i)
+	{
+		const ImVec2 Min(Corners[2 * i].X + 0.5f, Corners[2 * i].Y + 0.5f);
+		const ImVec2 Max(Corners[2 * i + 1].X - 0.5f, Corners[2 * i + 1].Y - 0.5f);
+		const ImU32 Color = GetColor(Colors, NumColors, i);
+		const ImDrawIdx Base = (ImDrawIdx)DrawList->_VtxCurrentIdx;
+		for (const float Offset : { Half, -Half })
+		{
+			WriteVtx(DrawList, ImVec2(Min.x - Offset, Min.y - Offset), Uv, Color);
+			WriteVtx(DrawList, ImVec2(Max.x + Offset, Min.y - Offset), Uv, Color);
+			WriteVtx(DrawList, ImVec2(Max.x + Offset, Max.y + Offset), Uv, Color);
+			WriteVtx(DrawList, ImVec2(Min.x - Offset, Max.y + Offset), Uv, Color);
+		}
+		for (int32 k = 0; k < 4; ++k)
+		{
+			const int32 Next = (k + 1) % 4;
+			WriteQuadIdx(DrawList, Base, k, Next, 4 + Next, 4 + k);
+		}
+		DrawList->_VtxCurrentIdx += 8;
+	});
+}
+
+void FImGuiDrawListBatch::AddCircles(ImDrawList* DrawList, const FVector2D* Centers, int32 NumCircles, const float* Radii, int32 NumRadii, const ImU32* Colors, int32 NumColors, float Thickness, bool bFilled, int32 NumSegments)
+{
+	if (DrawList == nullptr || NumCircles <= 0 || NumRadii <= 0 || NumColors <= 0)
+		return;
+
+	const ImVec2 Uv = DrawList->_Data->TexUvWhitePixel;
+	const bool bAntiAliased = (DrawList->Flags & (bFilled ? ImDrawListFlags_AntiAliasedFill : ImDrawListFlags_AntiAliasedLines)) != 0;
+
+	float MaxRadius = 0.0f;
+	for (int32 i = 0; i < FMath::Min(NumRadii, NumCircles); ++i)
+	{
+		MaxRadius = FMath::Max(MaxRadius, Radii[i]);
+	}
+
+	// one segment count per batch, so the unit circle is computed once
+	const int32 Segments = GetCircleSegments(DrawList, MaxRadius, NumSegments);
+	TArray<ImVec2, TInlineAllocator<64>> Unit;
+	Unit.SetNumUninitialized(Segments);
+	for (int32 s = 0; s < Segments; ++s)
+	{
+		const float Angle = 2.0f * PI * s / Segments;
+		Unit[s] = ImVec2(FMath::Cos(Angle), FMath::Sin(Angle));
+	}
+
+	// rings of vertices at radius + offset, with quads between consecutive rings (filled circles add a center vertex)
+	float Offsets[4];
+	bool bOpaque[4];
+	int32 NumRings = 0;
+	auto AddRing = [&](float Offset, bool bIsOpaque) { Offsets[NumRings] = Offset; bOpaque[NumRings] = bIsOpaque; ++NumRings; };
+	if (bFilled)
+	{
+		AddRing(bAntiAliased ? -FringeSize * 0.5f : 0.0f, true);
+		if (bAntiAliased)
+			AddRing(FringeSize * 0.5f, false);
+	}
+	else
+	{
+		const float Core = bAntiAliased ? FMath::Max(0.0f, Thickness - FringeSize) * 0.5f : Thickness * 0.5f;
+		if (bAntiAliased)
+			AddRing(Core + FringeSize, false);
+		AddRing(Core, true);
+		AddRing(-Core, true);
+		if (bAntiAliased)
+			AddRing(-Core - FringeSize, false);
+	}
+
+	const int32 CenterVtx = bFilled ? 1 : 0;
+	const int32 VtxPerItem = CenterVtx + NumRings * Segments;
+	const int32 IdxPerItem = (bFilled ? 3 * Segments : 0) + (NumRings - 1) * 6 * Segments;
+
+	WriteItems(DrawList, NumCircles, VtxPerItem, IdxPerItem, [&](int32 i)
+	{
+		const ImVec2 Center = ToVec(Centers[i]);
+		const float Radius = Radii[FMath::Min(i, NumRadii - 1)];
+		const ImU32 Color = GetColor(Colors, NumColors, i);
+		const ImDrawIdx Base = (ImDrawIdx)DrawList->_VtxCurrentIdx;
+
+		if (bFilled)
+		{
+			WriteVtx(DrawList, Center, Uv, Color);
+		}
+		for (int32 r = 0; r < NumRings; ++r)
+		{
+			const float RingRadius = FMath::Max(0.0f, Radius + Offsets[r]);
+			const ImU32 RingColor = bOpaque[r] ? Color : Transparent(Color);
+			for (int32 s = 0; s < Segments; ++s)
+			{
+				WriteVtx(DrawList, ImVec2(Center.x + Unit[s].x * RingRadius, Center.y + Unit[s].y * RingRadius), Uv, RingColor);
+			}
+		}
+
+		if (bFilled)
+		{
+			// fan from the center to the first (opaque) ring
+			ImDrawIdx* Idx = DrawList->_IdxWritePtr;
+			for (int32 s = 0; s < Segments; ++s)
+			{
+				*Idx++ = Base;
+				*Idx++ = (ImDrawIdx)(Base + 1 + s);
+				*Idx++ = (ImDrawIdx)(Base + 1 + (s + 1) % Segments);
+			}
+			DrawList->_IdxWritePtr = Idx;
+		}
+		for (int32 r = 0; r + 1 < NumRings; ++r)
+		{
+			const int32 Ring = CenterVtx + r * Segments;
+			for (int32 s = 0; s < Segments; ++s)
+			{
+				const int32 Next = (s + 1) % Segments;
+				WriteQuadIdx(DrawList, Base, Ring + s, Ring + Next, Ring + Segments + Next, Ring + Segments + s);
+			}
+		}
+		DrawList->_VtxCurrentIdx += VtxPerItem;
+	});
+}
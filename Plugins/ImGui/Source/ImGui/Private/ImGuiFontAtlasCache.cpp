@@ -0,0 +1,390 @@
+// Distributed under the MIT License (MIT) (see accompanying LICENSE file)
+
+
+#include "ImGuiFontAtlasCache.h"
+
+#include "Async/Async.h"
+#include "Async/MappedFileHandle.h"
+#include "HAL/FileManager.h"
+#include "HAL/PlatformFilemanager.h"
+#include "Hash/CityHash.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+
+#include <imgui_internal.h>
+
+namespace
+{
+	constexpr uint32 FileMagic = 0x41464749; // 'IGFA'
+	constexpr uint32 FileVersion = 1;
+	constexpr int32 NumTexUvLines = IM_DRAWLIST_TEX_LINES_WIDTH_MAX + 1;
+
+	struct FFileHeader
+	{
+		uint32 Magic;
+		uint32 Version;
+		uint64 Key;
+		int32 TexWidth;
+		int32 TexHeight;
+		ImVec2 TexUvScale;
+		ImVec2 TexUvWhitePixel;
+		ImVec4 TexUvLines[NumTexUvLines];
+		int32 NumFonts;
+		int32 NumCustomRects;
+		int32 PackIdMouseCursors;
+		int32 PackIdLines;
+	};
+
+	struct FFontRecord
+	{
+		float FontSize;
+		float Ascent;
+		float Descent;
+		int32 MetricsTotalSurface;
+		int32 NumGlyphs;
+		int32 FirstConfig;
+		int32 ConfigDataCount;
+		ImWchar FallbackChar;
+		ImWchar EllipsisChar;
+	};
+
+	struct FCustomRectRecord
+	{
+		uint16 Width, Height, X, Y;
+		uint32 GlyphID;
+		float GlyphAdvanceX;
+		ImVec2 GlyphOffset;
+		int32 Font; // index in the atlas fonts, or -1
+	};
+
+	int32 FindFont(const ImFontAtlas* Atlas, const ImFont* Font)
+	{
+		for (int32 i = 0; i < Atlas->Fonts.Size; ++i)
+		{
+			if (Atlas->Fonts[i] == Font)
+				return i;
+		}
+		return INDEX_NONE;
+	}
+
+	struct FKeyHasher
+	{
+		uint64 Hash = 0x9E3779B97F4A7C15ull;
+
+		void Mix(const void* Data, int64 Size)
+		{
+			Hash = CityHash64WithSeed(static_cast<const char*>(Data), Size, Hash);
+		}
+
+		template<typename T>
+		void Mix(const T& Value)
+		{
+			static_assert(TIsArithmetic<T>::Value, "hash fields one by one, structs may have padding");
+			Mix(&Value, sizeof(T));
+		}
+
+		void Mix(const ImVec2& Value)
+		{
+			Mix(Value.x);
+			Mix(Value.y);
+		}
+	};
+
+	// Reads from a file that was mapped (or loaded) whole, checking every read against its end.
+	struct FReader
+	{
+		const uint8* Ptr;
+		const uint8* End;
+
+		const uint8* Take(int64 Size)
+		{
+			if (Size < 0 || End - Ptr < Size)
+				return nullptr;
+			const uint8* Result = Ptr;
+			Ptr += Size;
+			return Result;
+		}
+
+		template<typename T>
+		bool Read(T& Out)
+		{
+			const uint8* Data = Take(sizeof(T));
+			if (Data)
+			{
+				FMemory::Memcpy(&Out, Data, sizeof(T));
+			}
+			return Data != nullptr;
+		}
+	};
+
+	bool Parse(ImFontAtlas* Atlas, uint64 Key, const uint8* Data, int64 Size)
+	{
+		FReader Reader{ Data, Data + Size };
+
+		FFileHeader Header;
+		if (!Reader.Read(Header) || Header.Magic != FileMagic || Header.Version != FileVersion || Header.Key != Key
+			|| Header.NumFonts != Atlas->Fonts.Size || Header.TexWidth <= 0 || Header.TexHeight <= 0)
+			return false;
+
+		// stage everything first, the atlas is only touched once the whole file checked out
+		TArray<FFontRecord, TInlineAllocator<8>> Fonts;
+		TArray<const uint8*, TInlineAllocator<8>> Glyphs;
+		for (int32 i = 0; i < Header.NumFonts; ++i)
+		{
+			FFontRecord& Font = Fonts.AddDefaulted_GetRef();
+			if (!Reader.Read(Font) || Font.FirstConfig < 0 || Font.ConfigDataCount <= 0 || Font.FirstConfig + Font.ConfigDataCount > Atlas->ConfigData.Size)
+				return false;
+			Glyphs.Add(Reader.Take((int64)Font.NumGlyphs * sizeof(ImFontGlyph)));
+			if (Glyphs.Last() == nullptr)
+				return false;
+		}
+
+		const uint8* Rects = Reader.Take((int64)Header.NumCustomRects * sizeof(FCustomRectRecord));
+		const uint8* Pixels = Reader.Take((int64)Header.TexWidth * Header.TexHeight);
+		if (Rects == nullptr || Pixels == nullptr)
+			return false;
+
+		Atlas->ClearTexData();
+		Atlas->TexWidth = Header.TexWidth;
+		Atlas->TexHeight = Header.TexHeight;
+		Atlas->TexUvScale = Header.TexUvScale;
+		Atlas->TexUvWhitePixel = Header.TexUvWhitePixel;
+		FMemory::Memcpy(Atlas->TexUvLines, Header.TexUvLines, sizeof(Header.TexUvLines));
+		Atlas->PackIdMouseCursors = Header.PackIdMouseCursors;
+		Atlas->PackIdLines = Header.PackIdLines;
+
+		// ImGui owns and frees the pixels, so they are copied out of the mapping
+		const int32 NumPixels = Header.TexWidth * Header.TexHeight;
+		Atlas->TexPixelsAlpha8 = static_cast<unsigned char*>(IM_ALLOC(NumPixels));
+		FMemory::Memcpy(Atlas->TexPixelsAlpha8, Pixels, NumPixels);
+
+		Atlas->CustomRects.resize(Header.NumCustomRects);
+		for (int32 i = 0; i < Header.NumCustomRects; ++i)
+		{
+			FCustomRectRecord Record;
+			FMemory::Memcpy(&Record, Rects + i * sizeof(FCustomRectRecord), sizeof(FCustomRectRecord));
+
+			ImFontAtlasCustomRect& Rect = Atlas->CustomRects[i];
+			Rect.Width = Record.Width;
+			Rect.Height = Record.Height;
+			Rect.X = Record.X;
+			Rect.Y = Record.Y;
+			Rect.GlyphID = Record.GlyphID;
+			Rect.GlyphAdvanceX = Record.GlyphAdvanceX;
+			Rect.GlyphOffset = Record.GlyphOffset;
+			Rect.Font = Record.Font >= 0 && Record.Font < Atlas->Fonts.Size ? Atlas->Fonts[Record.Font] : nullptr;
+		}
+
+		for (int32 i = 0; i < Header.NumFonts; ++i)
+		{
+			const FFontRecord& Record = Fonts[i];
+			ImFont* Font = Atlas->Fonts[i];
+			Font->ContainerAtlas = Atlas;
+			Font->ConfigData = &Atlas->ConfigData[Record.FirstConfig];
+			Font->ConfigDataCount = (short)Record.ConfigDataCount;
+			Font->FontSize = Record.FontSize;
+			Font->Ascent = Record.Ascent;
+			Font->Descent = Record.Descent;
+			Font->MetricsTotalSurface = Record.MetricsTotalSurface;
+			Font->FallbackChar = Record.FallbackChar;
+			Font->EllipsisChar = Record.EllipsisChar;
+
+			Font->Glyphs.resize(Record.NumGlyphs);
+			FMemory::Memcpy(Font->Glyphs.Data, Glyphs[i], Record.NumGlyphs * sizeof(ImFontGlyph));
+			Font->BuildLookupTable();
+		}
+
+		return true;
+	}
+}
+
+uint64 FImGuiFontAtlasCache::ComputeKey(const ImFontAtlas* Atlas)
+{
+	FKeyHasher Hasher;
+	Hasher.Mix((int32)IMGUI_VERSION_NUM);
+	Hasher.Mix((int32)sizeof(ImWchar));
+	Hasher.Mix((int32)sizeof(ImFontGlyph));
+	Hasher.Mix((int32)Atlas->Flags);
+	Hasher.Mix((int32)Atlas->TexDesiredWidth);
+	Hasher.Mix((int32)Atlas->TexGlyphPadding);
+	Hasher.Mix((int32)Atlas->Fonts.Size);
+
+	for (const ImFontConfig& Config : Atlas->ConfigData)
+	{
+		Hasher.Mix(Config.FontData, Config.FontDataSize);
+		Hasher.Mix((int32)Config.FontDataSize);
+		Hasher.Mix((int32)Config.FontNo);
+		Hasher.Mix(Config.SizePixels);
+		Hasher.Mix((int32)Config.OversampleH);
+		Hasher.Mix((int32)Config.OversampleV);
+		Hasher.Mix(Config.PixelSnapH);
+		Hasher.Mix(Config.GlyphExtraSpacing);
+		Hasher.Mix(Config.GlyphOffset);
+		Hasher.Mix(Config.GlyphMinAdvanceX);
+		Hasher.Mix(Config.GlyphMaxAdvanceX);
+		Hasher.Mix(Config.MergeMode);
+		Hasher.Mix((uint32)Config.RasterizerFlags);
+		Hasher.Mix(Config.RasterizerMultiply);
+		Hasher.Mix((uint32)Config.EllipsisChar);
+		Hasher.Mix((int32)FindFont(Atlas, Config.DstFont));
+
+		// zero terminated list of ranges, null for the default ranges
+		const ImWchar* Ranges = Config.GlyphRanges;
+		int32 NumRanges = 0;
+		while (Ranges && Ranges[NumRanges * 2] != 0)
+		{
+			++NumRanges;
+		}
+		Hasher.Mix(Ranges, NumRanges * 2 * sizeof(ImWchar));
+	}
+
+	for (const ImFontAtlasCustomRect& Rect : Atlas->CustomRects)
+	{
+		Hasher.Mix((uint32)Rect.Width);
+		Hasher.Mix((uint32)Rect.Height);
+		Hasher.Mix((uint32)Rect.GlyphID);
+		Hasher.Mix(Rect.GlyphAdvanceX);
+		Hasher.Mix(Rect.GlyphOffset);
+		Hasher.Mix((int32)FindFont(Atlas, Rect.Font));
+	}
+
+	return Hasher.Hash;
+}
+
+FString FImGuiFontAtlasCache::GetCacheFilename(uint64 Key)
+{
+	return FPaths::ProjectSavedDir() / TEXT("ImGui") / FString::Printf(TEXT("FontAtlas-%016llx.bin"), Key);
+}
+
+bool FImGuiFontAtlasCache::Load(ImFontAtlas* Atlas, uint64 Key)
+{
+	const FString Filename = GetCacheFilename(Key);
+	IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+	if (!PlatformFile.FileExists(*Filename))
+		return false;
+
+	bool bLoaded = false;
+	TUniquePtr<IMappedFileHandle> Handle(PlatformFile.OpenMapped(*Filename));
+	TUniquePtr<IMappedFileRegion> Region(Handle ? Handle->MapRegion(0, Handle->GetFileSize()) : nullptr);
+	if (Region)
+	{
+		bLoaded = Parse(Atlas, Key, Region->GetMappedPtr(), Region->GetMappedSize());
+	}
+	else
+	{
+		// platforms without mapped files
+		TArray<uint8> Data;
+		bLoaded = FFileHelper::LoadFileToArray(Data, *Filename) && Parse(Atlas, Key, Data.GetData(), Data.Num());
+	}
+
+	if (!bLoaded)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("ImGui font atlas cache: ignoring invalid file %s"), *Filename);
+	}
+	return bLoaded;
+}
+
+void FImGuiFontAtlasCache::Save(const ImFontAtlas* Atlas, uint64 Key)
+{
+	if (Atlas->TexPixelsAlpha8 == nullptr || Atlas->TexWidth <= 0 || Atlas->TexHeight <= 0)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("ImGui font atlas cache: the atlas has no alpha 8 pixels to save"));
+		return;
+	}
+
+	FFileHeader Header;
+	FMemory::Memzero(Header);
+	Header.Magic = FileMagic;
+	Header.Version = FileVersion;
+	Header.Key = Key;
+	Header.TexWidth = Atlas->TexWidth;
+	Header.TexHeight = Atlas->TexHeight;
+	Header.TexUvScale = Atlas->TexUvScale;
+	Header.TexUvWhitePixel = Atlas->TexUvWhitePixel;
+	FMemory::Memcpy(Header.TexUvLines, Atlas->TexUvLines, sizeof(Header.TexUvLines));
+	Header.NumFonts = Atlas->Fonts.Size;
+	Header.NumCustomRects = Atlas->CustomRects.Size;
+	Header.PackIdMouseCursors = Atlas->PackIdMouseCursors;
+	Header.PackIdLines = Atlas->PackIdLines;
+
+	TArray<uint8> Data;
+	Data.Append(reinterpret_cast<const uint8*>(&Header), sizeof(Header));
+
+	for (const ImFont* Font : Atlas->Fonts)
+	{
+		FFontRecord Record;
+		FMemory::Memzero(Record);
+		Record.FontSize = Font->FontSize;
+		Record.Ascent = Font->Ascent;
+		Record.Descent = Font->Descent;
+		Record.MetricsTotalSurface = Font->MetricsTotalSurface;
+		Record.NumGlyphs = Font->Glyphs.Size;
+		Record.FirstConfig = Font->ConfigData ? (int32)(Font->ConfigData - Atlas->ConfigData.Data) : 0;
+		Record.ConfigDataCount = Font->ConfigDataCount;
+		Record.FallbackChar = Font->FallbackChar;
+		Record.EllipsisChar = Font->EllipsisChar;
+
+		Data.Append(reinterpret_cast<const uint8*>(&Record), sizeof(Record));
+		Data.Append(reinterpret_cast<const uint8*>(Font->Glyphs.Data), Font->Glyphs.Size * sizeof(ImFontGlyph));
+	}
+
+	for (const ImFontAtlasCustomRect& Rect : Atlas->CustomRects)
+	{
+		FCustomRectRecord Record;
+		FMemory::Memzero(Record);
+		Record.Width = Rect.Width;
+		Record.Height = Rect.Height;
+		Record.X = Rect.X;
+		Record.Y = Rect.Y;
+		Record.GlyphID = Rect.GlyphID;
+		Record.GlyphAdvanceX = Rect.GlyphAdvanceX;
+		Record.GlyphOffset = Rect.GlyphOffset;
+		Record.Font = FindFont(Atlas, Rect.Font);
+		Data.Append(reinterpret_cast<const uint8*>(&Record), sizeof(Record));
+	}
+
+	Data.Append(Atlas->TexPixelsAlpha8, Atlas->TexWidth * Atlas->TexHeight);
+
+	// written next to the target and renamed, so a launch never maps a partial file
+	Async(EAsyncExecution::ThreadPool, [Key, Data = MoveTemp(Data)]()
+	{
+		const FString Filename = GetCacheFilename(Key);
+		const FString TempFilename = Filename + TEXT(".tmp");
+		IFileManager& FileManager = IFileManager::Get();
+
+		if (!FFileHelper::SaveArrayToFile(Data, *TempFilename) || !FileManager.Move(*Filename, *TempFilename, true, true))
+		{
+			UE_LOG(LogTemp, Warning, TEXT("ImGui font atlas cache: failed to write %s"), *Filename);
+			FileManager.Delete(*TempFilename, false, true, true);
+			return;
+		}
+
+		const FString Directory = FPaths::GetPath(Filename);
+		TArray<FString> Files;
+		FileManager.FindFiles(Files, *(Directory / TEXT("FontAtlas-*.bin")), true, false);
+		for (const FString& File : Files)
+		{
+			if (File != FPaths::GetCleanFilename(Filename))
+			{
+				FileManager.Delete(*(Directory / File), false, true, true);
+			}
+		}
+	});
+}
+
+bool FImGuiFontAtlasCache::Build(ImFontAtlas* Atlas)
+{
+	// without fonts Build adds the default one, which changes the key
+	if (Atlas->ConfigData.Size == 0 || Atlas->Locked)
+		return Atlas->Build();
+
+	const uint64 Key = ComputeKey(Atlas);
+	if (Load(Atlas, Key))
+		return true;
+
+	if (!Atlas->Build())
+		return false;
+
+	Save(Atlas, Key);
+	return true;
+}
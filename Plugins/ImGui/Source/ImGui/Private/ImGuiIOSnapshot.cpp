@@ -0,0 +1,91 @@
+// Distributed under the MIT License (MIT) (see accompanying LICENSE file)
+
+
+#include "ImGuiIOSnapshot.h"
+
+#include <imgui.h>
+
+namespace
+{
+	struct FCachedSnapshot
+	{
+		ImGuiContext* Context = nullptr;
+		int32 FrameCount = -1;
+		FImGuiIOSnapshot Snapshot;
+	};
+}
+
+const FImGuiIOSnapshot& FImGuiIOSnapshot::Get()
+{
+	static FCachedSnapshot Cached;
+
+	ImGuiContext* Context = ImGui::GetCurrentContext();
+	if (Context == nullptr)
+	{
+		Cached = FCachedSnapshot();
+		return Cached.Snapshot;
+	}
+
+	const int32 FrameCount = ImGui::GetFrameCount();
+	if (Cached.Context != Context || Cached.FrameCount != FrameCount)
+	{
+		Cached.Context = Context;
+		Cached.FrameCount = FrameCount;
+		Cached.Snapshot.Fill();
+	}
+	return Cached.Snapshot;
+}
+
+void FImGuiIOSnapshot::Fill()
+{
+	const ImGuiIO& IO = ImGui::GetIO();
+	static_assert(IM_ARRAYSIZE(ImGuiIO::KeysDown) <= NumKeys, "ImGui has more keys than the snapshot");
+	static_assert(IM_ARRAYSIZE(ImGuiIO::MouseDown) <= 32, "ImGui has more mouse buttons than the masks");
+
+	FrameCount = ImGui::GetFrameCount();
+	DeltaTime = IO.DeltaTime;
+	DisplaySize = FVector2D(IO.DisplaySize.x, IO.DisplaySize.y);
+	MousePos = FVector2D(IO.MousePos.x, IO.MousePos.y);
+	MouseDelta = FVector2D(IO.MouseDelta.x, IO.MouseDelta.y);
+	MouseWheel = IO.MouseWheel;
+	MouseWheelH = IO.MouseWheelH;
+
+	MouseDown = MouseClicked = MouseDoubleClicked = MouseReleased = 0;
+	for (int32 Button = 0; Button < IM_ARRAYSIZE(IO.MouseDown); ++Button)
+	{
+		const int32 Bit = 1 << Button;
+		MouseDown |= IO.MouseDown[Button] ? Bit : 0;
+		MouseClicked |= IO.MouseClicked[Button] ? Bit : 0;
+		MouseDoubleClicked |= IO.MouseDoubleClicked[Button] ? Bit : 0;
+		MouseReleased |= IO.MouseReleased[Button] ? Bit : 0;
+	}
+
+	bKeyCtrl = IO.KeyCtrl;
+	bKeyShift = IO.KeyShift;
+	bKeyAlt = IO.KeyAlt;
+	bKeySuper = IO.KeySuper;
+	bWantCaptureMouse = IO.WantCaptureMouse;
+	bWantCaptureKeyboard = IO.WantCaptureKeyboard;
+	bWantTextInput = IO.WantTextInput;
+
+	// pressed and released the same way as IsKeyPressed (without repeat) and IsKeyReleased
+	FMemory::Memzero(KeysDown);
+	FMemory::Memzero(KeysPressed);
+	FMemory::Memzero(KeysReleased);
+	for (int32 Key = 0; Key < IM_ARRAYSIZE(IO.KeysDown); ++Key)
+	{
+		const uint32 Bit = 1u << (Key & 31);
+		if (IO.KeysDown[Key])
+		{
+			KeysDown[Key >> 5] |= Bit;
+		}
+		if (IO.KeysDownDuration[Key] == 0.0f)
+		{
+			KeysPressed[Key >> 5] |= Bit;
+		}
+		if (IO.KeysDownDurationPrev[Key] >= 0.0f && !IO.KeysDown[Key])
+		{
+			KeysReleased[Key >> 5] |= Bit;
+		}
+	}
+}
@@ -0,0 +1,212 @@
+// Distributed under the MIT License (MIT) (see accompanying LICENSE file)
+
+
+#include "ImGuiIniPersistence.h"
+
+#include "Async/Async.h"
+#include "Engine/World.h"
+#include "HAL/FileManager.h"
+#include "Misc/CoreDelegates.h"
+#include "Misc/Crc.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+
+#include "ImGuiDelegates.h"
+
+#include <imgui.h>
+
+namespace
+{
+	struct FContextState
+	{
+		FString Filename;
+
+		// what ImGui had, given back on disable
+		const char* IniFilename = nullptr;
+		float IniSavingRate = 5.0f;
+
+		TArray<ANSICHAR> Pending;
+		bool bPending = false;
+		double FirstChange = 0.0;
+		double LastChange = 0.0;
+
+		uint32 WrittenCrc = 0;
+		bool bWritten = false;
+		TFuture<void> Write;
+	};
+
+	struct FStorage
+	{
+		// keys of destroyed contexts stay, they are only compared with the current context
+		TMap<ImGuiContext*, FContextState> Contexts;
+		float DebounceSeconds = 1.0f;
+		float MaxDelaySeconds = 10.0f;
+		bool bEnabled = false;
+		bool bBound = false;
+	};
+
+	FStorage& GetStorage()
+	{
+		static FStorage Storage;
+		return Storage;
+	}
+
+	TArray<ANSICHAR> Snapshot()
+	{
+		size_t Size = 0;
+		const char* Data = ImGui::SaveIniSettingsToMemory(&Size);
+		TArray<ANSICHAR> Out;
+		Out.Append(Data, (int32)Size);
+		return Out;
+	}
+
+	void StartWrite(FContextState& State, bool bWaitForPrevious)
+	{
+		// writes of a file never overlap, a change made meanwhile waits for the next update
+		if (State.Write.IsValid() && !State.Write.IsReady())
+		{
+			if (!bWaitForPrevious)
+				return;
+			State.Write.Wait();
+		}
+
+		State.bPending = false;
+		const uint32 Crc = FCrc::MemCrc32(State.Pending.GetData(), State.Pending.Num());
+		if (State.bWritten && Crc == State.WrittenCrc)
+			return;
+
+		State.WrittenCrc = Crc;
+		State.bWritten = true;
+		State.Write = Async(EAsyncExecution::ThreadPool, [Filename = State.Filename, Data = MoveTemp(State.Pending)]()
+		{
+			FImGuiIniPersistence::WriteFile(Filename, Data);
+		});
+	}
+}
+
+bool FImGuiIniPersistence::WriteFile(const FString& Filename, const TArray<ANSICHAR>& Data)
+{
+	const FString TempFilename = Filename + TEXT(".tmp");
+	IFileManager& FileManager = IFileManager::Get();
+	FileManager.MakeDirectory(*FPaths::GetPath(Filename), true);
+
+	const TArrayView<const uint8> Bytes(reinterpret_cast<const uint8*>(Data.GetData()), Data.Num());
+	if (!FFileHelper::SaveArrayToFile(Bytes, *TempFilename) || !FileManager.Move(*Filename, *TempFilename, true, true))
+	{
+		UE_LOG(LogTemp, Warning, TEXT("ImGui: failed to write settings to %s"), *Filename);
+		FileManager.Delete(*TempFilename, false, true, true);
+		return false;
+	}
+	return true;
+}
+
+void FImGuiIniPersistence::Enable(float DebounceSeconds, float MaxDelaySeconds)
+{
+	FStorage& Storage = GetStorage();
+	Storage.DebounceSeconds = FMath::Max(0.0f, DebounceSeconds);
+	Storage.MaxDelaySeconds = FMath::Max(Storage.DebounceSeconds, MaxDelaySeconds);
+	Storage.bEnabled = true;
+
+	// bound once and for good, contexts are given back one by one after a disable
+	if (!Storage.bBound)
+	{
+		Storage.bBound = true;
+		FImGuiDelegates::OnMultiContextDebug().AddStatic(&FImGuiIniPersistence::Update);
+		FWorldDelegates::OnWorldCleanup.AddLambda([](UWorld*, bool, bool) { FImGuiIniPersistence::Flush(); });
+		FCoreDelegates::OnPreExit.AddLambda([]() { FImGuiIniPersistence::Flush(true); });
+	}
+}
+
+void FImGuiIniPersistence::Disable()
+{
+	Flush(true);
+	GetStorage().bEnabled = false;
+}
+
+bool FImGuiIniPersistence::IsEnabled()
+{
+	return GetStorage().bEnabled;
+}
+
+void FImGuiIniPersistence::Update()
+{
+	ImGuiContext* Context = ImGui::GetCurrentContext();
+	if (Context == nullptr)
+		return;
+
+	FStorage& Storage = GetStorage();
+	ImGuiIO& IO = ImGui::GetIO();
+
+	if (!Storage.bEnabled)
+	{
+		if (FContextState* State = Storage.Contexts.Find(Context))
+		{
+			if (IO.IniFilename == nullptr && State->IniFilename)
+			{
+				IO.IniFilename = State->IniFilename;
+				IO.IniSavingRate = State->IniSavingRate;
+			}
+			Storage.Contexts.Remove(Context);
+		}
+		return;
+	}
+
+	FContextState& State = Storage.Contexts.FindOrAdd(Context);
+	if (IO.IniFilename)
+	{
+		// a new context (maybe at the address of a destroyed one): ImGui has loaded the file, saving moves here
+		State = FContextState();
+		State.Filename = UTF8_TO_TCHAR(IO.IniFilename);
+		State.IniFilename = IO.IniFilename;
+		State.IniSavingRate = IO.IniSavingRate;
+		IO.IniFilename = nullptr;
+		IO.IniSavingRate = SnapshotInterval;
+	}
+	if (State.Filename.IsEmpty())
+		return;
+
+	const double Now = FPlatformTime::Seconds();
+	if (IO.WantSaveIniSettings)
+	{
+		State.Pending = Snapshot();
+		IO.WantSaveIniSettings = false;
+		if (!State.bPending)
+		{
+			State.bPending = true;
+			State.FirstChange = Now;
+		}
+		State.LastChange = Now;
+	}
+
+	if (State.bPending && (Now - State.LastChange >= Storage.DebounceSeconds || Now - State.FirstChange >= Storage.MaxDelaySeconds))
+	{
+		StartWrite(State, false);
+	}
+}
+
+void FImGuiIniPersistence::Flush(bool bWait)
+{
+	for (TPair<ImGuiContext*, FContextState>& Context : GetStorage().Contexts)
+	{
+		FContextState& State = Context.Value;
+		if (State.bPending)
+		{
+			StartWrite(State, true);
+		}
+		if (bWait && State.Write.IsValid())
+		{
+			State.Write.Wait();
+		}
+	}
+}
+
+void FImGuiIniPersistence::SaveAsync(const FString& Filename)
+{
+	if (ImGui::GetCurrentContext() == nullptr || Filename.IsEmpty())
+		return;
+
+	Async(EAsyncExecution::ThreadPool, [Filename, Data = Snapshot()]()
+	{
+		WriteFile(Filename, Data);
+	});
+}
@@ -0,0 +1,474 @@
+// Distributed under the MIT License (MIT) (see accompanying LICENSE file)
+
+
+#include "ImGuiLogConsole.h"
+
+#include "Misc/CoreDelegates.h"
+
+#include "ImGuiDelegates.h"
+#include "ImGuiModule.h"
+
+#include <imgui.h>
+
+//-----------------------------------------------------------------------------
+// Capture
+//-----------------------------------------------------------------------------
+
+FImGuiLogCapture::FImGuiLogCapture()
+	: Segments(MakeUnique<FSegment[]>(NumSegments))
+	, Head(0)
+{
+}
+
+namespace
+{
+	// Keeps the capture in GLog until exit, or until the module is unloaded (its statics go with it).
+	struct FCaptureRegistration
+	{
+		FOutputDevice* Device;
+		FDelegateHandle PreExitHandle;
+
+		explicit FCaptureRegistration(FOutputDevice* InDevice)
+			: Device(InDevice)
+		{
+			if (GLog)
+			{
+				GLog->AddOutputDevice(Device);
+			}
+			PreExitHandle = FCoreDelegates::OnPreExit.AddRaw(this, &FCaptureRegistration::Unregister);
+		}
+
+		~FCaptureRegistration()
+		{
+			Unregister();
+		}
+
+		void Unregister()
+		{
+			if (Device == nullptr)
+				return;
+
+			FCoreDelegates::OnPreExit.Remove(PreExitHandle);
+			if (GLog)
+			{
+				GLog->RemoveOutputDevice(Device);
+			}
+			Device = nullptr;
+		}
+	};
+}
+
+FImGuiLogCapture& FImGuiLogCapture::Get()
+{
+	// never deleted, a logging thread may still be inside Serialize when it is taken out of GLog
+	static FImGuiLogCapture* Capture = new FImGuiLogCapture();
+	static FCaptureRegistration Registration(Capture);
+	return *Capture;
+}
+
+uint64 FImGuiLogCapture::GetFirst(uint64 InHead)
+{
+	// the segment of the head may be recycling the oldest one, so the oldest segment doesn't count
+	const uint64 HeadSegment = InHead / SegmentLines;
+	return HeadSegment >= NumSegments - 1 ? (HeadSegment - (NumSegments - 1)) * SegmentLines : 0;
+}
+
+void FImGuiLogCapture::Serialize(const TCHAR* V, ELogVerbosity::Type Verbosity, const FName& Category)
+{
+	Serialize(V, Verbosity, Category, FPlatformTime::Seconds() - GStartTime);
+}
+
+void FImGuiLogCapture::Serialize(const TCHAR* V, ELogVerbosity::Type Verbosity, const FName& Category, const double Time)
+{
+	if (V == nullptr || Verbosity == ELogVerbosity::SetColor)
+		return;
+	Verbosity = (ELogVerbosity::Type)(Verbosity & ELogVerbosity::VerbosityMask);
+
+	// one entry per line, so all rows have the same height
+	FTCHARToUTF8 Utf8(V);
+	const ANSICHAR* Text = Utf8.Get();
+	const int32 Length = Utf8.Length();
+	int32 Start = 0;
+	for (int32 i = 0; i <= Length; ++i)
+	{
+		if (i == Length || Text[i] == '\n')
+		{
+			int32 End = i;
+			if (End > Start && Text[End - 1] == '\r')
+			{
+				--End;
+			}
+			if (End > Start || i < Length)
+			{
+				Write(Text + Start, End - Start, Verbosity, Category, Time);
+			}
+			Start = i + 1;
+		}
+	}
+}
+
+void FImGuiLogCapture::Write(const ANSICHAR* Text, int32 Length, ELogVerbosity::Type Verbosity, const FName& Category, double Time)
+{
+	const uint64 Line = Head.IncrementExchange();
+	const uint64 Generation = Line / SegmentLines;
+	FSegment& Segment = Segments[Generation % NumSegments];
+
+	// reserve the text, the first writer of a new generation starts the segment over
+	uint64 Cursor = Segment.TextCursor.Load();
+	uint32 Offset = 0;
+	uint32 Taken = 0;
+	for (;;)
+	{
+		const uint64 CursorGeneration = Cursor >> 32;
+		if (CursorGeneration > Generation)
+			return; // lapped by the other writers while this one was preempted
+
+		const uint32 Used = CursorGeneration == Generation ? (uint32)Cursor : 0;
+		Taken = FMath::Min<uint32>(FMath::Min(Length, MaxLineBytes), SegmentBytes - Used);
+		if (Segment.TextCursor.CompareExchange(Cursor, (Generation << 32) | (Used + Taken)))
+		{
+			Offset = Used;
+			break;
+		}
+	}
+
+	FSlot& Slot = Segment.Slots[Line % SegmentLines];
+	FMemory::Memcpy(Segment.Text + Offset, Text, Taken);
+	Slot.Category = Category;
+	Slot.Time = Time;
+	Slot.TextOffset = Offset;
+	Slot.TextLength = Taken;
+	Slot.Verbosity = (uint8)Verbosity;
+	Slot.bTruncated = Taken < (uint32)Length;
+	Slot.Stamp.Store(Line + 1);
+}
+
+bool FImGuiLogCapture::Read(uint64 Line, FImGuiLogLine& Out) const
+{
+	const uint64 Generation = Line / SegmentLines;
+	const FSegment& Segment = Segments[Generation % NumSegments];
+	const FSlot& Slot = Segment.Slots[Line % SegmentLines];
+	if (Slot.Stamp.Load() != Line + 1)
+		return false;
+
+	const uint32 Offset = FMath::Min<uint32>(Slot.TextOffset, SegmentBytes);
+	const uint32 Length = FMath::Min<uint32>(Slot.TextLength, SegmentBytes - Offset);
+	Out.Category = Slot.Category;
+	Out.Time = Slot.Time;
+	Out.Verbosity = (ELogVerbosity::Type)Slot.Verbosity;
+	Out.bTruncated = Slot.bTruncated;
+	Out.Text.Reset(Length + 1);
+	Out.Text.Append(Segment.Text + Offset, Length);
+	Out.Text.Add('\0');
+
+	// a writer of the next generation moves the cursor before touching the text or the slot
+	return (Segment.TextCursor.Load() >> 32) == Generation && Slot.Stamp.Load() == Line + 1;
+}
+
+//-----------------------------------------------------------------------------
+// Console
+//-----------------------------------------------------------------------------
+
+namespace
+{
+	// indexed by verbosity, VeryVerbose is All
+	const char* const VerbosityNames[] = { "All", "Fatal", "Error", "Warning", "Display", "Log", "Verbose" };
+
+	ImVec4 GetVerbosityColor(ELogVerbosity::Type Verbosity)
+	{
+		switch (Verbosity)
+		{
+		case ELogVerbosity::Fatal:
+		case ELogVerbosity::Error: return ImVec4(1.0f, 0.4f, 0.4f, 1.0f);
+		case ELogVerbosity::Warning: return ImVec4(1.0f, 0.8f, 0.3f, 1.0f);
+		case ELogVerbosity::Verbose:
+		case ELogVerbosity::VeryVerbose: return ImGui::GetStyleColorVec4(ImGuiCol_TextDisabled);
+		default: return ImGui::GetStyleColorVec4(ImGuiCol_Text);
+		}
+	}
+
+	void SetUtf8(TArray<ANSICHAR>& Out, const FString& Text)
+	{
+		FTCHARToUTF8 Utf8(*Text);
+		Out.Reset(Utf8.Length() + 1);
+		Out.Append(Utf8.Get(), Utf8.Length());
+		Out.Add('\0');
+	}
+}
+
+FImGuiLogConsole::FImGuiLogConsole()
+{
+	// starts with the lines still in the ring
+	ReadLine = ClearLine = FImGuiLogCapture::GetFirst(FImGuiLogCapture::Get().GetHead());
+	Query.Add('\0');
+}
+
+bool FImGuiLogConsole::PassesFilter(const FImGuiLogLine& Line) const
+{
+	return Line.Verbosity <= MaxVerbosity
+		&& (Category.IsNone() || Line.Category == Category)
+		&& (Query.Num() <= 1 || FCStringAnsi::Stristr(Line.Text.GetData(), Query.GetData()) != nullptr);
+}
+
+void FImGuiLogConsole::Update()
+{
+	const FImGuiLogCapture& Capture = FImGuiLogCapture::Get();
+	const uint64 Head = Capture.GetHead();
+	const uint64 First = FImGuiLogCapture::GetFirst(Head);
+
+	if (ReadLine < First)
+	{
+		LostLines += First - ReadLine;
+		ReadLine = First;
+	}
+
+	while (ReadLine < Head)
+	{
+		if (!Capture.Read(ReadLine, Scratch))
+		{
+			// still being written, unless its writer was lapped and gave up
+			if (Head - ReadLine <= FImGuiLogCapture::SegmentLines)
+				break;
+			++LostLines;
+			++ReadLine;
+			continue;
+		}
+
+		if (!CategoryNames.Contains(Scratch.Category))
+		{
+			SetUtf8(CategoryNames.Add(Scratch.Category), Scratch.Category.ToString());
+		}
+		if (PassesFilter(Scratch))
+		{
+			Matches.Add(ReadLine);
+		}
+		++ReadLine;
+	}
+
+	// drop the matches that left the ring
+	while (MatchesBegin < Matches.Num() && Matches[MatchesBegin] < First)
+	{
+		++MatchesBegin;
+	}
+	if (MatchesBegin > 4096 && MatchesBegin * 2 > Matches.Num())
+	{
+		Matches.RemoveAt(0, MatchesBegin, false);
+		MatchesBegin = 0;
+	}
+}
+
+void FImGuiLogConsole::Refilter(bool bNarrow)
+{
+	const FImGuiLogCapture& Capture = FImGuiLogCapture::Get();
+	TArray<uint64> NewMatches;
+
+	if (bNarrow)
+	{
+		// a narrower filter can only keep previous matches
+		NewMatches.Reserve(NumMatches());
+		for (int32 i = MatchesBegin; i < Matches.Num(); ++i)
+		{
+			if (Capture.Read(Matches[i], Scratch) && PassesFilter(Scratch))
+			{
+				NewMatches.Add(Matches[i]);
+			}
+		}
+	}
+	else
+	{
+		const uint64 First = FMath::Max(ClearLine, FImGuiLogCapture::GetFirst(Capture.GetHead()));
+		for (uint64 Line = First; Line < ReadLine; ++Line)
+		{
+			if (Capture.Read(Line, Scratch) && PassesFilter(Scratch))
+			{
+				NewMatches.Add(Line);
+			}
+		}
+	}
+
+	Matches = MoveTemp(NewMatches);
+	MatchesBegin = 0;
+}
+
+void FImGuiLogConsole::SetFilter(const FString& Text, ELogVerbosity::Type InMaxVerbosity, FName InCategory)
+{
+	TArray<ANSICHAR> NewQuery;
+	SetUtf8(NewQuery, Text);
+	InMaxVerbosity = (ELogVerbosity::Type)(InMaxVerbosity & ELogVerbosity::VerbosityMask);
+	if (NewQuery == Query && InMaxVerbosity == MaxVerbosity && InCategory == Category)
+		return;
+
+	const bool bNarrow = (Query.Num() <= 1 || FCStringAnsi::Stristr(NewQuery.GetData(), Query.GetData()) != nullptr)
+		&& InMaxVerbosity <= MaxVerbosity
+		&& (Category.IsNone() || InCategory == Category);
+
+	Query = MoveTemp(NewQuery);
+	MaxVerbosity = InMaxVerbosity;
+	Category = InCategory;
+	Refilter(bNarrow);
+}
+
+void FImGuiLogConsole::Clear()
+{
+	ClearLine = ReadLine;
+	Matches.Reset();
+	MatchesBegin = 0;
+}
+
+void FImGuiLogConsole::DrawToolbar()
+{
+	bool bFilterChanged = false;
+	FName NewCategory = Category;
+	ELogVerbosity::Type NewVerbosity = MaxVerbosity;
+
+	ImGui::SetNextItemWidth(ImGui::GetFontSize() * 16.0f);
+	bFilterChanged |= ImGui::InputTextWithHint("##filter", "Filter", FilterText, sizeof(FilterText));
+
+	ImGui::SameLine();
+	ImGui::SetNextItemWidth(ImGui::GetFontSize() * 8.0f);
+	const int32 VerbosityIndex = MaxVerbosity >= ELogVerbosity::All ? 0 : (int32)MaxVerbosity;
+	if (ImGui::BeginCombo("##verbosity", VerbosityNames[VerbosityIndex]))
+	{
+		for (int32 i = 0; i < UE_ARRAY_COUNT(VerbosityNames); ++i)
+		{
+			if (ImGui::Selectable(VerbosityNames[i], i == VerbosityIndex))
+			{
+				NewVerbosity = i == 0 ? ELogVerbosity::All : (ELogVerbosity::Type)i;
+				bFilterChanged = true;
+			}
+		}
+		ImGui::EndCombo();
+	}
+
+	ImGui::SameLine();
+	ImGui::SetNextItemWidth(ImGui::GetFontSize() * 12.0f);
+	const TArray<ANSICHAR>* CategoryName = Category.IsNone() ? nullptr : CategoryNames.Find(Category);
+	if (ImGui::BeginCombo("##category", CategoryName ? CategoryName->GetData() : "All categories"))
+	{
+		if (ImGui::Selectable("All categories", Category.IsNone()))
+		{
+			NewCategory = NAME_None;
+			bFilterChanged = true;
+		}
+		for (const TPair<FName, TArray<ANSICHAR>>& Name : CategoryNames)
+		{
+			if (ImGui::Selectable(Name.Value.GetData(), Name.Key == Category))
+			{
+				NewCategory = Name.Key;
+				bFilterChanged = true;
+			}
+		}
+		ImGui::EndCombo();
+	}
+
+	ImGui::SameLine();
+	if (ImGui::Button("Clear"))
+	{
+		Clear();
+	}
+	ImGui::SameLine();
+	ImGui::Checkbox("Auto-scroll", &bAutoScroll);
+	ImGui::SameLine();
+	ImGui::TextDisabled("%d lines", NumMatches());
+
+	if (bFilterChanged)
+	{
+		SetFilter(UTF8_TO_TCHAR(FilterText), NewVerbosity, NewCategory);
+	}
+}
+
+void FImGuiLogConsole::DrawLine(uint64 Line)
+{
+	if (!FImGuiLogCapture::Get().Read(Line, Scratch))
+	{
+		ImGui::TextDisabled("...");
+		return;
+	}
+
+	ImGui::TextDisabled("[%9.3f]", Scratch.Time);
+	ImGui::SameLine();
+	const TArray<ANSICHAR>* CategoryName = CategoryNames.Find(Scratch.Category);
+	ImGui::TextUnformatted(CategoryName ? CategoryName->GetData() : "");
+	ImGui::SameLine();
+	ImGui::PushStyleColor(ImGuiCol_Text, GetVerbosityColor(Scratch.Verbosity));
+	ImGui::TextUnformatted(Scratch.Text.GetData(), Scratch.Text.GetData() + Scratch.Text.Num() - 1);
+	ImGui::PopStyleColor();
+	if (Scratch.bTruncated)
+	{
+		ImGui::SameLine();
+		ImGui::TextDisabled("[truncated]");
+	}
+}
+
+void FImGuiLogConsole::Draw(const char* WindowName, bool* bOpen)
+{
+	if (!ImGui::Begin(WindowName, bOpen))
+	{
+		ImGui::End();
+		return;
+	}
+
+	DrawToolbar();
+	ImGui::Separator();
+
+	if (ImGui::BeginChild("##lines", ImVec2(0.0f, 0.0f), false, ImGuiWindowFlags_HorizontalScrollbar))
+	{
+		const bool bAtBottom = ImGui::GetScrollY() >= ImGui::GetScrollMaxY();
+
+		ImGuiListClipper Clipper;
+		Clipper.Begin(NumMatches());
+		while (Clipper.Step())
+		{
+			for (int32 Row = Clipper.DisplayStart; Row < Clipper.DisplayEnd; ++Row)
+			{
+				DrawLine(Matches[MatchesBegin + Row]);
+			}
+		}
+
+		if (bAutoScroll && bAtBottom)
+		{
+			ImGui::SetScrollHereY(1.0f);
+		}
+	}
+	ImGui::EndChild();
+	ImGui::End();
+}
+
+//-----------------------------------------------------------------------------
+// Component
+//-----------------------------------------------------------------------------
+
+UImGuiLogConsoleComponent::UImGuiLogConsoleComponent()
+{
+	PrimaryComponentTick.bCanEverTick = false;
+}
+
+void UImGuiLogConsoleComponent::BeginPlay()
+{
+	Super::BeginPlay();
+
+	Console = MakeUnique<FImGuiLogConsole>();
+	ImGuiTickHandle = FImGuiDelegates::OnWorldDebug().AddUObject(this, &UImGuiLogConsoleComponent::ImGuiTick);
+}
+
+void UImGuiLogConsoleComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	FImGuiDelegates::OnWorldDebug().Remove(ImGuiTickHandle);
+	Console.Reset();
+
+	Super::EndPlay(EndPlayReason);
+}
+
+void UImGuiLogConsoleComponent::ImGuiTick()
+{
+	if (!Console)
+		return;
+
+	// the filter index keeps up even while the window is hidden
+	Console->Update();
+
+	if (!bOpen || !FImGuiModule::Get().GetProperties().IsInputEnabled())
+		return;
+
+	Console->Draw(TCHAR_TO_UTF8(*WindowName), &bOpen);
+}
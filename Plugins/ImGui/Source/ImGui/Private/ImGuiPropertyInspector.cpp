@@ -0,0 +1,628 @@
+// Distributed under the MIT License (MIT) (see accompanying LICENSE file)
+
+
+#include "ImGuiPropertyInspector.h"
+
+#include "UObject/EnumProperty.h"
+#include "UObject/TextProperty.h"
+#include "UObject/UnrealType.h"
+
+#include <imgui.h>
+#include <imgui_internal.h>
+
+namespace
+{
+	enum class EKind : uint8
+	{
+		Bool,
+		Numeric,
+		Enum,
+		Name,
+		String,
+		Text,
+		Vector,
+		Vector2D,
+		Rotator,
+		LinearColor,
+		Color,
+		Struct,
+		Array,
+		Set,
+		Map,
+		Object,
+		Other
+	};
+
+	bool IsContainer(EKind Kind)
+	{
+		return Kind == EKind::Struct || Kind == EKind::Array || Kind == EKind::Set || Kind == EKind::Map || Kind == EKind::Object;
+	}
+
+	// Everything needed to draw one property, resolved when the layout is compiled.
+	struct FVisitor
+	{
+		EKind Kind = EKind::Other;
+		const FProperty* Property = nullptr;
+		int32 Offset = 0;
+		int32 ArrayDim = 1;
+		int32 ElementSize = 0;
+		bool bReadOnly = false;
+		TArray<ANSICHAR> Label; // utf8, zero terminated
+
+		// Numeric, Enum
+		ImGuiDataType DataType = ImGuiDataType_S32;
+
+		// Enum
+		TArray<int64> EnumValues;
+		TArray<TArray<ANSICHAR>> EnumNames;
+
+		// Struct
+		const UScriptStruct* Struct = nullptr;
+
+		// Array, Set, Map: element (or key) and value visitors, in the same plan
+		int32 Inner = INDEX_NONE;
+		int32 Value = INDEX_NONE;
+	};
+
+	struct FPlan
+	{
+		TWeakObjectPtr<const UStruct> Struct;
+
+		// the property chain is rebuilt when a class or struct is recompiled
+		const FProperty* PropertyLink = nullptr;
+		int32 PropertiesSize = 0;
+
+		TArray<FVisitor> Visitors;
+		TArray<int32> Roots;
+	};
+
+	struct FDrawContext
+	{
+		bool bEditable = true;
+		bool bChanged = false;
+		int32 Depth = 0;
+	};
+
+	TMap<const UStruct*, TUniquePtr<FPlan>>& GetPlans()
+	{
+		static TMap<const UStruct*, TUniquePtr<FPlan>> Plans;
+		return Plans;
+	}
+
+	TArray<ANSICHAR> ToUtf8(const FString& Text)
+	{
+		FTCHARToUTF8 Converter(*Text);
+		TArray<ANSICHAR> Result;
+		Result.Append(Converter.Get(), Converter.Length());
+		Result.Add('\0');
+		return Result;
+	}
+
+	ImGuiDataType GetDataType(const FNumericProperty* Property)
+	{
+		if (Property->IsFloatingPoint())
+			return Property->ElementSize == 8 ? ImGuiDataType_Double : ImGuiDataType_Float;
+
+		const bool bSigned = Property->IsA<FInt8Property>() || Property->IsA<FInt16Property>() || Property->IsA<FIntProperty>() || Property->IsA<FInt64Property>();
+		switch (Property->ElementSize)
+		{
+		case 1: return bSigned ? ImGuiDataType_S8 : ImGuiDataType_U8;
+		case 2: return bSigned ? ImGuiDataType_S16 : ImGuiDataType_U16;
+		case 8: return bSigned ? ImGuiDataType_S64 : ImGuiDataType_U64;
+		default: return bSigned ? ImGuiDataType_S32 : ImGuiDataType_U32;
+		}
+	}
+
+	int64 ReadInteger(const void* Ptr, ImGuiDataType DataType)
+	{
+		switch (DataType)
+		{
+		case ImGuiDataType_S8: return *static_cast<const int8*>(Ptr);
+		case ImGuiDataType_U8: return *static_cast<const uint8*>(Ptr);
+		case ImGuiDataType_S16: return *static_cast<const int16*>(Ptr);
+		case ImGuiDataType_U16: return *static_cast<const uint16*>(Ptr);
+		case ImGuiDataType_S32: return *static_cast<const int32*>(Ptr);
+		case ImGuiDataType_U32: return *static_cast<const uint32*>(Ptr);
+		default: return *static_cast<const int64*>(Ptr);
+		}
+	}
+
+	void WriteInteger(void* Ptr, ImGuiDataType DataType, int64 Value)
+	{
+		switch (DataType)
+		{
+		case ImGuiDataType_S8: *static_cast<int8*>(Ptr) = (int8)Value; break;
+		case ImGuiDataType_U8: *static_cast<uint8*>(Ptr) = (uint8)Value; break;
+		case ImGuiDataType_S16: *static_cast<int16*>(Ptr) = (int16)Value; break;
+		case ImGuiDataType_U16: *static_cast<uint16*>(Ptr) = (uint16)Value; break;
+		case ImGuiDataType_S32: *static_cast<int32*>(Ptr) = (int32)Value; break;
+		case ImGuiDataType_U32: *static_cast<uint32*>(Ptr) = (uint32)Value; break;
+		default: *static_cast<int64*>(Ptr) = Value; break;
+		}
+	}
+
+	const FPlan& GetPlan(const UStruct* Struct);
+
+	// Compiles #Property into a visitor of #Plan and returns its index. All casts happen here.
+	int32 Compile(FPlan& Plan, const FProperty* Property, int32 Offset, const FString& Name)
+	{
+		FVisitor Visitor;
+		Visitor.Property = Property;
+		Visitor.Offset = Offset;
+		Visitor.ArrayDim = Property->ArrayDim;
+		Visitor.ElementSize = Property->ElementSize;
+		Visitor.bReadOnly = Property->HasAnyPropertyFlags(CPF_EditConst);
+		Visitor.Label = ToUtf8(Name);
+
+		const FByteProperty* ByteProperty = CastField<FByteProperty>(Property);
+		if (Property->IsA<FBoolProperty>())
+		{
+			Visitor.Kind = EKind::Bool;
+		}
+		else if (const FEnumProperty* EnumProperty = CastField<FEnumProperty>(Property))
+		{
+			Visitor.Kind = EKind::Enum;
+			Visitor.DataType = GetDataType(EnumProperty->GetUnderlyingProperty());
+			const UEnum* Enum = EnumProperty->GetEnum();
+			for (int32 i = 0; Enum && i < Enum->NumEnums() - 1; ++i)
+			{
+				Visitor.EnumValues.Add(Enum->GetValueByIndex(i));
+				Visitor.EnumNames.Add(ToUtf8(Enum->GetNameStringByIndex(i)));
+			}
+		}
+		else if (ByteProperty && ByteProperty->Enum)
+		{
+			Visitor.Kind = EKind::Enum;
+			Visitor.DataType = ImGuiDataType_U8;
+			for (int32 i = 0; i < ByteProperty->Enum->NumEnums() - 1; ++i)
+			{
+				Visitor.EnumValues.Add(ByteProperty->Enum->GetValueByIndex(i));
+				Visitor.EnumNames.Add(ToUtf8(ByteProperty->Enum->GetNameStringByIndex(i)));
+			}
+		}
+		else if (const FNumericProperty* NumericProperty = CastField<FNumericProperty>(Property))
+		{
+			Visitor.Kind = EKind::Numeric;
+			Visitor.DataType = GetDataType(NumericProperty);
+		}
+		else if (Property->IsA<FNameProperty>())
+		{
+			Visitor.Kind = EKind::Name;
+		}
+		else if (Property->IsA<FStrProperty>())
+		{
+			Visitor.Kind = EKind::String;
+		}
+		else if (Property->IsA<FTextProperty>())
+		{
+			Visitor.Kind = EKind::Text;
+		}
+		else if (const FStructProperty* StructProperty = CastField<FStructProperty>(Property))
+		{
+			const UScriptStruct* Struct = StructProperty->Struct;
+			Visitor.Kind =
+				Struct == TBaseStructure<FVector>::Get() ? EKind::Vector :
+				Struct == TBaseStructure<FVector2D>::Get() ? EKind::Vector2D :
+				Struct == TBaseStructure<FRotator>::Get() ? EKind::Rotator :
+				Struct == TBaseStructure<FLinearColor>::Get() ? EKind::LinearColor :
+				Struct == TBaseStructure<FColor>::Get() ? EKind::Color :
+				EKind::Struct;
+			Visitor.Struct = Struct;
+		}
+		else if (const FArrayProperty* ArrayProperty = CastField<FArrayProperty>(Property))
+		{
+			Visitor.Kind = EKind::Array;
+			Visitor.Inner = Compile(Plan, ArrayProperty->Inner, 0, FString());
+		}
+		else if (const FSetProperty* SetProperty = CastField<FSetProperty>(Property))
+		{
+			Visitor.Kind = EKind::Set;
+			Visitor.Inner = Compile(Plan, SetProperty->ElementProp, 0, FString());
+		}
+		else if (const FMapProperty* MapProperty = CastField<FMapProperty>(Property))
+		{
+			Visitor.Kind = EKind::Map;
+			Visitor.Inner = Compile(Plan, MapProperty->KeyProp, 0, FString());
+			Visitor.Value = Compile(Plan, MapProperty->ValueProp, 0, FString());
+		}
+		else if (Property->IsA<FObjectProperty>())
+		{
+			Visitor.Kind = EKind::Object;
+		}
+		else
+		{
+			Visitor.Kind = EKind::Other;
+			Visitor.Label = ToUtf8(FString::Printf(TEXT("%s (%s)"), *Name, *Property->GetCPPType()));
+		}
+
+		return Plan.Visitors.Add(MoveTemp(Visitor));
+	}
+
+	const FPlan& GetPlan(const UStruct* Struct)
+	{
+		TUniquePtr<FPlan>& Plan = GetPlans().FindOrAdd(Struct);
+		if (Plan && Plan->Struct.Get() == Struct && Plan->PropertyLink == Struct->PropertyLink && Plan->PropertiesSize == Struct->GetPropertiesSize())
+			return *Plan;
+
+		Plan = MakeUnique<FPlan>();
+		Plan->Struct = Struct;
+		Plan->PropertyLink = Struct->PropertyLink;
+		Plan->PropertiesSize = Struct->GetPropertiesSize();
+
+		for (TFieldIterator<FProperty> It(Struct, EFieldIteratorFlags::IncludeSuper); It; ++It)
+		{
+			if (It->HasAnyPropertyFlags(CPF_Deprecated))
+				continue;
+			Plan->Roots.Add(Compile(*Plan, *It, It->GetOffset_ForInternal(), It->GetAuthoredName()));
+		}
+		return *Plan;
+	}
+
+	// Short text of a simple value, for read only rows and map keys.
+	FString FormatValue(const FVisitor& Visitor, const uint8* Ptr)
+	{
+		switch (Visitor.Kind)
+		{
+		case EKind::Bool:
+			return static_cast<const FBoolProperty*>(Visitor.Property)->GetPropertyValue(Ptr) ? TEXT("true") : TEXT("false");
+		case EKind::Numeric:
+			switch (Visitor.DataType)
+			{
+			case ImGuiDataType_Float: return FString::SanitizeFloat(*reinterpret_cast<const float*>(Ptr));
+			case ImGuiDataType_Double: return FString::SanitizeFloat(*reinterpret_cast<const double*>(Ptr));
+			case ImGuiDataType_U64: return FString::Printf(TEXT("%llu"), *reinterpret_cast<const uint64*>(Ptr));
+			default: return FString::Printf(TEXT("%lld"), ReadInteger(Ptr, Visitor.DataType));
+			}
+		case EKind::Enum:
+		{
+			const int32 Index = Visitor.EnumValues.Find(ReadInteger(Ptr, Visitor.DataType));
+			return Index != INDEX_NONE ? FString(UTF8_TO_TCHAR(Visitor.EnumNames[Index].GetData())) : FString::Printf(TEXT("%lld"), ReadInteger(Ptr, Visitor.DataType));
+		}
+		case EKind::Name: return reinterpret_cast<const FName*>(Ptr)->ToString();
+		case EKind::String: return *reinterpret_cast<const FString*>(Ptr);
+		case EKind::Text: return reinterpret_cast<const FText*>(Ptr)->ToString();
+		case EKind::Vector: return reinterpret_cast<const FVector*>(Ptr)->ToString();
+		case EKind::Vector2D: return reinterpret_cast<const FVector2D*>(Ptr)->ToString();
+		case EKind::Rotator: return reinterpret_cast<const FRotator*>(Ptr)->ToString();
+		case EKind::LinearColor: return reinterpret_cast<const FLinearColor*>(Ptr)->ToString();
+		case EKind::Color: return reinterpret_cast<const FColor*>(Ptr)->ToString();
+		case EKind::Object:
+		{
+			const UObject* Object = static_cast<const FObjectPropertyBase*>(Visitor.Property)->GetObjectPropertyValue(Ptr);
+			return Object ? Object->GetName() : TEXT("None");
+		}
+		default:
+			return FString();
+		}
+	}
+
+	float GetRowHeight()
+	{
+		return ImGui::GetFrameHeight();
+	}
+
+	// True if a row at the cursor would be on screen. Rows all use the frame height, so skipped
+	// rows can be replaced by a dummy of the same size.
+	bool IsRowVisible()
+	{
+		return ImGui::IsRectVisible(ImVec2(1.0f, GetRowHeight()));
+	}
+
+	void SkipRow()
+	{
+		ImGui::Dummy(ImVec2(1.0f, GetRowHeight()));
+	}
+
+	// Tree node that only runs its widget code on screen. Call TreePop if it returns true.
+	bool BeginNode(const char* Id, const FString& Text)
+	{
+		ImGui::AlignTextToFramePadding();
+		if (IsRowVisible())
+			return ImGui::TreeNodeEx(Id, ImGuiTreeNodeFlags_None, "%s", TCHAR_TO_UTF8(*Text));
+
+		const bool bOpen = ImGui::TreeNodeBehaviorIsOpen(ImGui::GetID(Id));
+		SkipRow();
+		if (bOpen)
+		{
+			ImGui::TreePush(Id);
+		}
+		return bOpen;
+	}
+
+	void DrawPlan(const FPlan& Plan, uint8* Container, FDrawContext& Context);
+	void DrawValue(const FPlan& Plan, const FVisitor& Visitor, uint8* Ptr, const char* Label, FDrawContext& Context, bool bReadOnly);
+
+	void DrawStruct(const UStruct* Struct, uint8* Ptr, const char* Label, const FString& Text, FDrawContext& Context)
+	{
+		if (!BeginNode(Label, Text))
+			return;
+
+		if (Context.Depth < FImGuiPropertyInspector::MaxDepth)
+		{
+			++Context.Depth;
+			DrawPlan(GetPlan(Struct), Ptr, Context);
+			--Context.Depth;
+		}
+		ImGui::TreePop();
+	}
+
+	void DrawArray(const FPlan& Plan, const FVisitor& Visitor, uint8* Ptr, const char* Label, FDrawContext& Context, bool bReadOnly)
+	{
+		FScriptArrayHelper Helper(static_cast<const FArrayProperty*>(Visitor.Property), Ptr);
+		const int32 Num = Helper.Num();
+		if (!BeginNode(Label, FString::Printf(TEXT("%s [%d]"), UTF8_TO_TCHAR(Label), Num)))
+			return;
+
+		const FVisitor& Inner = Plan.Visitors[Visitor.Inner];
+		auto DrawElement = [&](int32 Index)
+		{
+			char ElementLabel[24];
+			FCStringAnsi::Sprintf(ElementLabel, "[%d]", Index);
+			ImGui::PushID(Index);
+			DrawValue(Plan, Inner, Helper.GetRawPtr(Index), ElementLabel, Context, bReadOnly);
+			ImGui::PopID();
+		};
+
+		if (!IsContainer(Inner.Kind))
+		{
+			// every element is one row, only the visible ones are drawn
+			ImGuiListClipper Clipper;
+			Clipper.Begin(Num, ImGui::GetFrameHeightWithSpacing());
+			while (Clipper.Step())
+			{
+				for (int32 i = Clipper.DisplayStart; i < Clipper.DisplayEnd; ++i)
+				{
+					DrawElement(i);
+				}
+			}
+		}
+		else
+		{
+			for (int32 i = 0; i < Num; ++i)
+			{
+				DrawElement(i);
+			}
+		}
+		ImGui::TreePop();
+	}
+
+	void DrawSet(const FPlan& Plan, const FVisitor& Visitor, uint8* Ptr, const char* Label, FDrawContext& Context)
+	{
+		FScriptSetHelper Helper(static_cast<const FSetProperty*>(Visitor.Property), Ptr);
+		if (!BeginNode(Label, FString::Printf(TEXT("%s {%d}"), UTF8_TO_TCHAR(Label), Helper.Num())))
+			return;
+
+		// set elements are hashed, changing them in place would break the set
+		const FVisitor& Inner = Plan.Visitors[Visitor.Inner];
+		for (int32 i = 0, Element = 0; i < Helper.GetMaxIndex(); ++i)
+		{
+			if (!Helper.IsValidIndex(i))
+				continue;
+
+			char ElementLabel[24];
+			FCStringAnsi::Sprintf(ElementLabel, "{%d}", Element++);
+			ImGui::PushID(i);
+			DrawValue(Plan, Inner, Helper.GetElementPtr(i), ElementLabel, Context, true);
+			ImGui::PopID();
+		}
+		ImGui::TreePop();
+	}
+
+	void DrawMap(const FPlan& Plan, const FVisitor& Visitor, uint8* Ptr, const char* Label, FDrawContext& Context, bool bReadOnly)
+	{
+		FScriptMapHelper Helper(static_cast<const FMapProperty*>(Visitor.Property), Ptr);
+		if (!BeginNode(Label, FString::Printf(TEXT("%s {%d}"), UTF8_TO_TCHAR(Label), Helper.Num())))
+			return;
+
+		// keys are hashed, only values can be edited; simple keys are shown as the label of their value
+		const FVisitor& Key = Plan.Visitors[Visitor.Inner];
+		const FVisitor& Value = Plan.Visitors[Visitor.Value];
+		for (int32 i = 0; i < Helper.GetMaxIndex(); ++i)
+		{
+			if (!Helper.IsValidIndex(i))
+				continue;
+
+			ImGui::PushID(i);
+			if (!IsContainer(Key.Kind))
+			{
+				const FTCHARToUTF8 KeyLabel(*FormatValue(Key, Helper.GetKeyPtr(i)));
+				DrawValue(Plan, Value, Helper.GetValuePtr(i), KeyLabel.Get(), Context, bReadOnly);
+			}
+			else if (BeginNode("##pair", FString::Printf(TEXT("[%d]"), i)))
+			{
+				DrawValue(Plan, Key, Helper.GetKeyPtr(i), "Key", Context, true);
+				DrawValue(Plan, Value, Helper.GetValuePtr(i), "Value", Context, bReadOnly);
+				ImGui::TreePop();
+			}
+			ImGui::PopID();
+		}
+		ImGui::TreePop();
+	}
+
+	void DrawValue(const FPlan& Plan, const FVisitor& Visitor, uint8* Ptr, const char* Label, FDrawContext& Context, bool bReadOnly)
+	{
+		switch (Visitor.Kind)
+		{
+		case EKind::Struct:
+			DrawStruct(Visitor.Struct, Ptr, Label, UTF8_TO_TCHAR(Label), Context);
+			return;
+		case EKind::Array:
+			DrawArray(Plan, Visitor, Ptr, Label, Context, bReadOnly);
+			return;
+		case EKind::Set:
+			DrawSet(Plan, Visitor, Ptr, Label, Context);
+			return;
+		case EKind::Map:
+			DrawMap(Plan, Visitor, Ptr, Label, Context, bReadOnly);
+			return;
+		case EKind::Object:
+		{
+			UObject* Object = static_cast<const FObjectPropertyBase*>(Visitor.Property)->GetObjectPropertyValue(Ptr);
+			if (Object == nullptr || Context.Depth >= FImGuiPropertyInspector::MaxDepth)
+				break;
+
+			// objects are expanded read only if the owner is
+			const bool bEditable = Context.bEditable;
+			Context.bEditable = bEditable && !bReadOnly;
+			DrawStruct(Object->GetClass(), reinterpret_cast<uint8*>(Object), Label, FString::Printf(TEXT("%s: %s"), UTF8_TO_TCHAR(Label), *Object->GetName()), Context);
+			Context.bEditable = bEditable;
+			return;
+		}
+		default:
+			break;
+		}
+
+		ImGui::AlignTextToFramePadding();
+		if (!IsRowVisible())
+		{
+			SkipRow();
+			return;
+		}
+
+		bool bChanged = false;
+		switch (bReadOnly || !Context.bEditable ? EKind::Other : Visitor.Kind)
+		{
+		case EKind::Bool:
+		{
+			const FBoolProperty* BoolProperty = static_cast<const FBoolProperty*>(Visitor.Property);
+			bool bValue = BoolProperty->GetPropertyValue(Ptr);
+			if (ImGui::Checkbox(Label, &bValue))
+			{
+				BoolProperty->SetPropertyValue(Ptr, bValue);
+				bChanged = true;
+			}
+			break;
+		}
+		case EKind::Numeric:
+		{
+			const bool bFloat = Visitor.DataType == ImGuiDataType_Float || Visitor.DataType == ImGuiDataType_Double;
+			bChanged = ImGui::DragScalar(Label, Visitor.DataType, Ptr, bFloat ? 0.1f : 1.0f);
+			break;
+		}
+		case EKind::Enum:
+		{
+			const int32 Current = Visitor.EnumValues.Find(ReadInteger(Ptr, Visitor.DataType));
+			if (ImGui::BeginCombo(Label, Current != INDEX_NONE ? Visitor.EnumNames[Current].GetData() : "?"))
+			{
+				for (int32 i = 0; i < Visitor.EnumValues.Num(); ++i)
+				{
+					if (ImGui::Selectable(Visitor.EnumNames[i].GetData(), i == Current))
+					{
+						WriteInteger(Ptr, Visitor.DataType, Visitor.EnumValues[i]);
+						bChanged = true;
+					}
+				}
+				ImGui::EndCombo();
+			}
+			break;
+		}
+		case EKind::Name:
+		case EKind::String:
+		{
+			char Buffer[512];
+			FCStringAnsi::Strncpy(Buffer, TCHAR_TO_UTF8(*FormatValue(Visitor, Ptr)), UE_ARRAY_COUNT(Buffer));
+			if (ImGui::InputText(Label, Buffer, UE_ARRAY_COUNT(Buffer), ImGuiInputTextFlags_EnterReturnsTrue))
+			{
+				const FString Value = UTF8_TO_TCHAR(Buffer);
+				if (Visitor.Kind == EKind::Name)
+				{
+					*reinterpret_cast<FName*>(Ptr) = FName(*Value);
+				}
+				else
+				{
+					*reinterpret_cast<FString*>(Ptr) = Value;
+				}
+				bChanged = true;
+			}
+			break;
+		}
+		case EKind::Vector:
+			bChanged = ImGui::DragFloat3(Label, &reinterpret_cast<FVector*>(Ptr)->X, 0.1f);
+			break;
+		case EKind::Vector2D:
+			bChanged = ImGui::DragFloat2(Label, &reinterpret_cast<FVector2D*>(Ptr)->X, 0.1f);
+			break;
+		case EKind::Rotator:
+			bChanged = ImGui::DragFloat3(Label, &reinterpret_cast<FRotator*>(Ptr)->Pitch, 0.1f);
+			break;
+		case EKind::LinearColor:
+			bChanged = ImGui::ColorEdit4(Label, &reinterpret_cast<FLinearColor*>(Ptr)->R);
+			break;
+		case EKind::Color:
+		{
+			FColor& Color = *reinterpret_cast<FColor*>(Ptr);
+			float Value[4] = { Color.R / 255.0f, Color.G / 255.0f, Color.B / 255.0f, Color.A / 255.0f };
+			if (ImGui::ColorEdit4(Label, Value))
+			{
+				Color = FColor(FMath::RoundToInt(Value[0] * 255.0f), FMath::RoundToInt(Value[1] * 255.0f), FMath::RoundToInt(Value[2] * 255.0f), FMath::RoundToInt(Value[3] * 255.0f));
+				bChanged = true;
+			}
+			break;
+		}
+		default:
+			ImGui::TextUnformatted(Label);
+			ImGui::SameLine();
+			ImGui::TextDisabled("%s", TCHAR_TO_UTF8(*FormatValue(Visitor, Ptr)));
+			break;
+		}
+		Context.bChanged |= bChanged;
+	}
+
+	void DrawPlan(const FPlan& Plan, uint8* Container, FDrawContext& Context)
+	{
+		for (const int32 Root : Plan.Roots)
+		{
+			const FVisitor& Visitor = Plan.Visitors[Root];
+			if (Visitor.ArrayDim == 1)
+			{
+				DrawValue(Plan, Visitor, Container + Visitor.Offset, Visitor.Label.GetData(), Context, Visitor.bReadOnly);
+				continue;
+			}
+
+			// static arrays, one row per element
+			for (int32 i = 0; i < Visitor.ArrayDim; ++i)
+			{
+				char Label[256];
+				FCStringAnsi::Snprintf(Label, UE_ARRAY_COUNT(Label), "%s[%d]", Visitor.Label.GetData(), i);
+				DrawValue(Plan, Visitor, Container + Visitor.Offset + i * Visitor.ElementSize, Label, Context, Visitor.bReadOnly);
+			}
+		}
+	}
+}
+
+bool FImGuiPropertyInspector::Draw(const UStruct* Struct, void* Container, bool bEditable)
+{
+	if (Struct == nullptr || Container == nullptr)
+		return false;
+
+	FDrawContext Context;
+	Context.bEditable = bEditable;
+	DrawPlan(GetPlan(Struct), static_cast<uint8*>(Container), Context);
+	return Context.bChanged;
+}
+
+bool FImGuiPropertyInspector::DrawObject(UObject* Object, bool bEditable)
+{
+	if (!IsValid(Object))
+	{
+		ImGui::TextDisabled("None");
+		return false;
+	}
+
+	ImGui::PushID(Object);
+	const bool bChanged = Draw(Object->GetClass(), Object, bEditable);
+	ImGui::PopID();
+	return bChanged;
+}
+
+void FImGuiPropertyInspector::Reset()
+{
+	GetPlans().Reset();
+}
+
+bool UImGuiPropertyInspectorFunction::InspectStruct(int32& value, bool editable)
+{
+	// We should never hit this! It's a stub to avoid NoExport on the class, the custom thunk is called instead
+	check(0);
+	return false;
+}
@@ -0,0 +1,303 @@
+// Distributed under the MIT License (MIT) (see accompanying LICENSE file)
+
+
+#include "ImGuiRetainedWindow.h"
+
+#include <imgui_internal.h>
+
+namespace
+{
+	// Commands of the copy, indices are relative to the first vertex of the segment.
+	struct FSegment
+	{
+		ImVec4 ClipRect;
+		ImTextureID TextureId;
+		int32 VtxBegin = 0;
+		int32 VtxCount = 0;
+		int32 IdxBegin = 0;
+		int32 IdxCount = 0;
+	};
+
+	struct FEntry
+	{
+		bool bValid = false;
+		uint32 InputsHash = 0;
+		ImVec2 Pos, Size, Scroll;
+		float FontSize = 0.0f;
+
+		// layout at the end of the content, relative to Pos
+		ImVec2 CursorPos, CursorMaxPos;
+
+		TArray<ImDrawVert> Vertices;
+		TArray<ImDrawIdx> Indices;
+		TArray<FSegment> Segments;
+
+		int32 ReplayedFrames = 0;
+		uint64 LastUsedFrame = 0;
+	};
+
+	// Windows of different contexts (one per world and PIE instance) share names and ids.
+	using FEntryKey = TPair<ImGuiContext*, ImGuiID>;
+
+	struct FOpenWindow
+	{
+		FEntryKey Key;
+		bool bRecording = false;
+		int32 VtxStart = 0;
+		int32 IdxStart = 0;
+	};
+
+	struct FStorage
+	{
+		// keys of destroyed contexts stay until trimmed, they are only compared with the current context
+		TMap<FEntryKey, FEntry> Entries;
+		TArray<FOpenWindow, TInlineAllocator<4>> Stack;
+		uint64 LastTrimFrame = 0;
+	};
+
+	FStorage& GetStorage()
+	{
+		static FStorage Storage;
+		return Storage;
+	}
+
+	void Trim(FStorage& Storage)
+	{
+		if (Storage.LastTrimFrame == GFrameCounter)
+			return;
+		Storage.LastTrimFrame = GFrameCounter;
+
+		for (auto It = Storage.Entries.CreateIterator(); It; ++It)
+		{
+			if (It.Value().LastUsedFrame + FImGuiRetainedWindow::MaxUnusedFrames < GFrameCounter)
+			{
+				It.RemoveCurrent();
+			}
+		}
+	}
+
+	bool SameVec(const ImVec2& A, const ImVec2& B)
+	{
+		return A.x == B.x && A.y == B.y;
+	}
+
+	// True if input can change how the content of #Window looks this frame.
+	bool IsInteracting(const ImGuiWindow* Window)
+	{
+		const ImGuiContext& G = *GImGui;
+		const ImGuiWindow* Root = Window->RootWindow;
+
+		if (G.HoveredWindow && G.HoveredWindow->RootWindow == Root)
+			return true;
+		if (G.ActiveId != 0 && G.ActiveIdWindow && G.ActiveIdWindow->RootWindow == Root)
+			return true;
+		if ((G.IO.ConfigFlags & (ImGuiConfigFlags_NavEnableKeyboard | ImGuiConfigFlags_NavEnableGamepad)) && G.NavWindow && G.NavWindow->RootWindow == Root)
+			return true;
+		for (const ImGuiPopupData& Popup : G.OpenPopupStack)
+		{
+			if (Popup.SourceWindow && Popup.SourceWindow->RootWindow == Root)
+				return true;
+		}
+		return false;
+	}
+
+	void Replay(const FEntry& Entry, ImGuiWindow* Window)
+	{
+		ImDrawList* DrawList = Window->DrawList;
+		const float DX = Window->Pos.x - Entry.Pos.x;
+		const float DY = Window->Pos.y - Entry.Pos.y;
+		const bool bMoved = DX != 0.0f || DY != 0.0f;
+
+		for (const FSegment& Segment : Entry.Segments)
+		{
+			// pushing the header of the segment lets the draw list merge it with its neighbours as usual
+			const ImVec4& Clip = Segment.ClipRect;
+			DrawList->PushClipRect(ImVec2(Clip.x + DX, Clip.y + DY), ImVec2(Clip.z + DX, Clip.w + DY), false);
+			DrawList->PushTextureID(Segment.TextureId);
+
+			// PrimReserve may start a new vertex offset with 16 bit indices, read the base after it
+			DrawList->PrimReserve(Segment.IdxCount, Segment.VtxCount);
+			const ImDrawIdx Base = (ImDrawIdx)DrawList->_VtxCurrentIdx;
+
+			const ImDrawVert* SrcVtx = Entry.Vertices.GetData() + Segment.VtxBegin;
+			ImDrawVert* DstVtx = DrawList->_VtxWritePtr;
+			if (bMoved)
+			{
+				for (int32 i = 0; i < Segment.VtxCount; ++i)
+				{
+					DstVtx[i] = SrcVtx[i];
+					DstVtx[i].pos.x += DX;
+					DstVtx[i].pos.y += DY;
+				}
+			}
+			else
+			{
+				FMemory::Memcpy(DstVtx, SrcVtx, Segment.VtxCount * sizeof(ImDrawVert));
+			}
+
+			const ImDrawIdx* SrcIdx = Entry.Indices.GetData() + Segment.IdxBegin;
+			ImDrawIdx* DstIdx = DrawList->_IdxWritePtr;
+			for (int32 i = 0; i < Segment.IdxCount; ++i)
+			{
+				DstIdx[i] = (ImDrawIdx)(Base + SrcIdx[i]);
+			}
+
+			DrawList->_VtxWritePtr += Segment.VtxCount;
+			DrawList->_IdxWritePtr += Segment.IdxCount;
+			DrawList->_VtxCurrentIdx += Segment.VtxCount;
+
+			DrawList->PopTextureID();
+			DrawList->PopClipRect();
+		}
+
+		// restore the layout, so that auto resize and scrolling see the same content size
+		Window->DC.CursorPos = ImVec2(Window->Pos.x + Entry.CursorPos.x, Window->Pos.y + Entry.CursorPos.y);
+		Window->DC.CursorMaxPos = ImVec2(Window->Pos.x + Entry.CursorMaxPos.x, Window->Pos.y + Entry.CursorMaxPos.y);
+	}
+
+	// Copies what was added to the draw list since #Open was recorded. Returns false if it can't be replayed.
+	bool Capture(const FOpenWindow& Open, const ImGuiWindow* Window, FEntry& Entry)
+	{
+		const ImDrawList* DrawList = Window->DrawList;
+		if (Window->DC.ChildWindows.Size > 0 || DrawList->_Splitter._Count > 1)
+			return false;
+
+		const int32 IdxEnd = DrawList->IdxBuffer.Size;
+		Entry.Vertices.Reset();
+		Entry.Indices.Reset();
+		Entry.Segments.Reset();
+
+		// walk back to the first command that holds indices of the content
+		int32 FirstCmd = DrawList->CmdBuffer.Size;
+		while (FirstCmd > 0)
+		{
+			const ImDrawCmd& Cmd = DrawList->CmdBuffer[FirstCmd - 1];
+			if ((int32)(Cmd.IdxOffset + Cmd.ElemCount) <= Open.IdxStart && Cmd.ElemCount > 0)
+				break;
+			--FirstCmd;
+		}
+
+		for (int32 CmdIndex = FirstCmd; CmdIndex < DrawList->CmdBuffer.Size; ++CmdIndex)
+		{
+			const ImDrawCmd& Cmd = DrawList->CmdBuffer[CmdIndex];
+			const int32 IdxBegin = FMath::Max((int32)Cmd.IdxOffset, Open.IdxStart);
+			const int32 IdxCmdEnd = FMath::Min((int32)(Cmd.IdxOffset + Cmd.ElemCount), IdxEnd);
+			if (IdxCmdEnd <= IdxBegin)
+				continue;
+			if (Cmd.UserCallback != nullptr)
+				return false;
+
+			uint32 VtxMin = MAX_uint32, VtxMax = 0;
+			for (int32 i = IdxBegin; i < IdxCmdEnd; ++i)
+			{
+				const uint32 Vtx = Cmd.VtxOffset + DrawList->IdxBuffer[i];
+				VtxMin = FMath::Min(VtxMin, Vtx);
+				VtxMax = FMath::Max(VtxMax, Vtx);
+			}
+			if ((int32)VtxMin < Open.VtxStart)
+				return false;
+
+			FSegment& Segment = Entry.Segments.AddDefaulted_GetRef();
+			Segment.ClipRect = Cmd.ClipRect;
+			Segment.TextureId = Cmd.TextureId;
+			Segment.VtxBegin = Entry.Vertices.Num();
+			Segment.VtxCount = VtxMax - VtxMin + 1;
+			Segment.IdxBegin = Entry.Indices.Num();
+			Segment.IdxCount = IdxCmdEnd - IdxBegin;
+
+			Entry.Vertices.Append(DrawList->VtxBuffer.Data + VtxMin, Segment.VtxCount);
+			Entry.Indices.AddUninitialized(Segment.IdxCount);
+			ImDrawIdx* Indices = Entry.Indices.GetData() + Segment.IdxBegin;
+			for (int32 i = 0; i < Segment.IdxCount; ++i)
+			{
+				Indices[i] = (ImDrawIdx)(Cmd.VtxOffset + DrawList->IdxBuffer[IdxBegin + i] - VtxMin);
+			}
+		}
+
+		Entry.CursorPos = ImVec2(Window->DC.CursorPos.x - Window->Pos.x, Window->DC.CursorPos.y - Window->Pos.y);
+		Entry.CursorMaxPos = ImVec2(Window->DC.CursorMaxPos.x - Window->Pos.x, Window->DC.CursorMaxPos.y - Window->Pos.y);
+		return true;
+	}
+}
+
+EImGuiRetainedWindowResult FImGuiRetainedWindow::Begin(const char* Name, bool* bOpen, ImGuiWindowFlags Flags, uint32 InputsHash, bool bDirty, int32 MaxReplayFrames)
+{
+	if (!ImGui::Begin(Name, bOpen, Flags))
+	{
+		ImGui::End();
+		return EImGuiRetainedWindowResult::Closed;
+	}
+
+	FStorage& Storage = GetStorage();
+	Trim(Storage);
+
+	ImGuiWindow* Window = ImGui::GetCurrentWindow();
+	const FEntryKey Key(GImGui, Window->ID);
+	FEntry& Entry = Storage.Entries.FindOrAdd(Key);
+	Entry.LastUsedFrame = GFrameCounter;
+
+	FOpenWindow& Open = Storage.Stack.AddDefaulted_GetRef();
+	Open.Key = Key;
+
+	const bool bCanReplay = Entry.bValid && !bDirty
+		&& Entry.InputsHash == InputsHash
+		&& SameVec(Entry.Size, Window->Size)
+		&& SameVec(Entry.Scroll, Window->Scroll)
+		&& Entry.FontSize == ImGui::GetFontSize()
+		&& (MaxReplayFrames <= 0 || Entry.ReplayedFrames < MaxReplayFrames)
+		&& Window->DrawList->_Splitter._Count <= 1
+		&& !IsInteracting(Window);
+
+	if (bCanReplay)
+	{
+		Replay(Entry, Window);
+		Entry.Pos = Window->Pos;
+		++Entry.ReplayedFrames;
+		return EImGuiRetainedWindowResult::Replayed;
+	}
+
+	Entry.bValid = false;
+	Entry.InputsHash = InputsHash;
+	Open.bRecording = true;
+	Open.VtxStart = Window->DrawList->VtxBuffer.Size;
+	Open.IdxStart = Window->DrawList->IdxBuffer.Size;
+	return EImGuiRetainedWindowResult::Rebuild;
+}
+
+void FImGuiRetainedWindow::End()
+{
+	FStorage& Storage = GetStorage();
+	if (Storage.Stack.Num() == 0)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("ImGui retained window: End called without Begin"));
+		return;
+	}
+
+	const FOpenWindow Open = Storage.Stack.Pop(false);
+	const ImGuiWindow* Window = ImGui::GetCurrentWindow();
+	FEntry* Entry = Storage.Entries.Find(Open.Key);
+	if (Open.bRecording && Entry && FEntryKey(GImGui, Window->ID) == Open.Key)
+	{
+		Entry->bValid = Capture(Open, Window, *Entry);
+		Entry->Pos = Window->Pos;
+		Entry->Size = Window->Size;
+		Entry->Scroll = Window->Scroll;
+		Entry->FontSize = ImGui::GetFontSize();
+		Entry->ReplayedFrames = 0;
+	}
+
+	ImGui::End();
+}
+
+void FImGuiRetainedWindow::Invalidate(const char* Name)
+{
+	if (FEntry* Entry = GetStorage().Entries.Find(FEntryKey(GImGui, ImHashStr(Name))))
+	{
+		Entry->bValid = false;
+	}
+}
+
+void FImGuiRetainedWindow::Reset()
+{
+	GetStorage().Entries.Reset();
+}
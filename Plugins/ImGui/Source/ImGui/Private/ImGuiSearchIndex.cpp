@@ -0,0 +1,254 @@
+// Distributed under the MIT License (MIT) (see accompanying LICENSE file)
+
+
+#include "ImGuiSearchIndex.h"
+
+#include "Algo/Sort.h"
+#include "Async/ParallelFor.h"
+#include "ImplotCache.h"
+
+namespace
+{
+	FORCEINLINE uint64 MakeTrigram(const TCHAR* Chars)
+	{
+		// 21 bits per character covers all of unicode, whatever the size of TCHAR
+		constexpr uint64 Mask = (1ull << 21) - 1;
+		return ((uint64)(Chars[0] & Mask) << 42) | ((uint64)(Chars[1] & Mask) << 21) | (uint64)(Chars[2] & Mask);
+	}
+
+	template<typename FuncType>
+	void ForEachUniqueTrigram(const FString& Text, FuncType Func)
+	{
+		TSet<uint64, DefaultKeyFuncs<uint64>, TInlineSetAllocator<64>> Seen;
+		const TCHAR* Chars = *Text;
+		for (int32 i = 0; i + 3 <= Text.Len(); ++i)
+		{
+			bool bAlreadySeen = false;
+			const uint64 Trigram = MakeTrigram(Chars + i);
+			Seen.Add(Trigram, &bAlreadySeen);
+			if (!bAlreadySeen)
+			{
+				Func(Trigram);
+			}
+		}
+	}
+}
+
+int32 FImGuiSearchIndex::AddRow(const FString& Text)
+{
+	const int32 Row = Texts.Add(Text.ToLower());
+	Generations.Add(0);
+	NumTrigrams.Add(0);
+	Alive.Add(true);
+	IndexRow(Row);
+	++Version;
+	return Row;
+}
+
+void FImGuiSearchIndex::SetRow(int32 Row, const FString& Text)
+{
+	if (Row < 0)
+		return;
+	while (Texts.Num() <= Row)
+	{
+		AddRow(FString());
+	}
+
+	FString Lower = Text.ToLower();
+	if (Alive[Row] && Texts[Row] == Lower)
+		return;
+
+	UnindexRow(Row);
+	Texts[Row] = MoveTemp(Lower);
+	Alive[Row] = true;
+	IndexRow(Row);
+	CompactIfNeeded();
+	++Version;
+}
+
+void FImGuiSearchIndex::RemoveRow(int32 Row)
+{
+	if (!Texts.IsValidIndex(Row) || !Alive[Row])
+		return;
+
+	UnindexRow(Row);
+	Texts[Row].Empty();
+	Alive[Row] = false;
+	CompactIfNeeded();
+	++Version;
+}
+
+void FImGuiSearchIndex::SetRows(const TArray<FString>& Rows)
+{
+	for (int32 Row = 0; Row < Rows.Num(); ++Row)
+	{
+		SetRow(Row, Rows[Row]);
+	}
+	for (int32 Row = Rows.Num(); Row < Texts.Num(); ++Row)
+	{
+		RemoveRow(Row);
+	}
+}
+
+void FImGuiSearchIndex::Reset()
+{
+	Texts.Reset();
+	Generations.Reset();
+	NumTrigrams.Reset();
+	Alive.Empty();
+	Postings.Reset();
+	NumPostings = NumStalePostings = 0;
+	Result.Reset();
+	LastQuery.Empty();
+	++Version;
+}
+
+void FImGuiSearchIndex::IndexRow(int32 Row)
+{
+	const uint32 Generation = Generations[Row];
+	int32 Count = 0;
+	ForEachUniqueTrigram(Texts[Row], [&](uint64 Trigram)
+	{
+		Postings.FindOrAdd(Trigram).Add({ Row, Generation });
+		++Count;
+	});
+	NumTrigrams[Row] = Count;
+	NumPostings += Count;
+}
+
+void FImGuiSearchIndex::UnindexRow(int32 Row)
+{
+	// the postings stay, bumping the generation makes them stale
+	++Generations[Row];
+	NumStalePostings += NumTrigrams[Row];
+	NumTrigrams[Row] = 0;
+}
+
+void FImGuiSearchIndex::CompactIfNeeded()
+{
+	if (NumStalePostings < 4096 || NumStalePostings * 2 < NumPostings)
+		return;
+
+	for (auto It = Postings.CreateIterator(); It; ++It)
+	{
+		It.Value().RemoveAllSwap([this](const FPosting& Posting) { return Posting.Generation != Generations[Posting.Row]; }, false);
+		if (It.Value().Num() == 0)
+		{
+			It.RemoveCurrent();
+		}
+	}
+	NumPostings -= NumStalePostings;
+	NumStalePostings = 0;
+}
+
+void FImGuiSearchIndex::Verify(const int32* Rows, int32 Count, const FString& Query, TArray<int32>& OutRows) const
+{
+	auto Matches = [this, &Query](int32 Row)
+	{
+		return Alive[Row] && (Query.IsEmpty() || Texts[Row].Contains(Query, ESearchCase::CaseSensitive));
+	};
+
+	const int32 NumTasks = ImPlotCache::GetNumTasks(Count, MinRowsPerTask);
+	if (NumTasks == 1)
+	{
+		for (int32 i = 0; i < Count; ++i)
+		{
+			if (Matches(Rows[i]))
+			{
+				OutRows.Add(Rows[i]);
+			}
+		}
+		return;
+	}
+
+	// each task keeps its matches, concatenated in task order so the input order is kept
+	TArray<TArray<int32>, TInlineAllocator<32>> TaskRows;
+	TaskRows.SetNum(NumTasks);
+	ParallelFor(NumTasks, [&](int32 Task)
+	{
+		const int32 Begin = (int64)Count * Task / NumTasks;
+		const int32 End = (int64)Count * (Task + 1) / NumTasks;
+		for (int32 i = Begin; i < End; ++i)
+		{
+			if (Matches(Rows[i]))
+			{
+				TaskRows[Task].Add(Rows[i]);
+			}
+		}
+	});
+
+	for (const TArray<int32>& Matched : TaskRows)
+	{
+		OutRows.Append(Matched);
+	}
+}
+
+const TArray<int32>& FImGuiSearchIndex::Find(const FString& Query)
+{
+	const FString Lower = Query.ToLower();
+	if (LastVersion == Version && Lower == LastQuery)
+		return Result;
+
+	// a query extending the previous one can only match rows the previous one matched
+	const bool bNarrow = LastVersion == Version && !LastQuery.IsEmpty() && Lower.Contains(LastQuery, ESearchCase::CaseSensitive);
+
+	const TArray<FPosting>* Smallest = nullptr;
+	bool bNoPosting = false;
+	if (Lower.Len() >= 3)
+	{
+		const TCHAR* Chars = *Lower;
+		for (int32 i = 0; i + 3 <= Lower.Len(); ++i)
+		{
+			const TArray<FPosting>* List = Postings.Find(MakeTrigram(Chars + i));
+			if (List == nullptr)
+			{
+				bNoPosting = true;
+				break;
+			}
+			if (Smallest == nullptr || List->Num() < Smallest->Num())
+			{
+				Smallest = List;
+			}
+		}
+	}
+
+	TArray<int32> Matches;
+	if (bNoPosting)
+	{
+		// some trigram of the query is in no row
+	}
+	else if (bNarrow && (Smallest == nullptr || Result.Num() <= Smallest->Num()))
+	{
+		Matches.Reserve(Result.Num());
+		Verify(Result.GetData(), Result.Num(), Lower, Matches);
+	}
+	else if (Smallest)
+	{
+		TArray<int32> Candidates;
+		Candidates.Reserve(Smallest->Num());
+		for (const FPosting& Posting : *Smallest)
+		{
+			if (Posting.Generation == Generations[Posting.Row])
+			{
+				Candidates.Add(Posting.Row);
+			}
+		}
+		Algo::Sort(Candidates);
+		Verify(Candidates.GetData(), Candidates.Num(), Lower, Matches);
+	}
+	else
+	{
+		TArray<int32> Rows;
+		Rows.SetNumUninitialized(Texts.Num());
+		for (int32 Row = 0; Row < Texts.Num(); ++Row)
+		{
+			Rows[Row] = Row;
+		}
+		Verify(Rows.GetData(), Rows.Num(), Lower, Matches);
+	}
+
+	Result = MoveTemp(Matches);
+	LastQuery = Lower;
+	LastVersion = Version;
+	return Result;
+}
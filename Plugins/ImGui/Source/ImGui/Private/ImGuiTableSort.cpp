@@ -0,0 +1,274 @@
+// Distributed under the MIT License (MIT) (see accompanying LICENSE file)
+
+
+#include "ImGuiTableSort.h"
+
+#include "Algo/Sort.h"
+#include "Async/ParallelFor.h"
+#include "ImplotCache.h"
+
+namespace
+{
+	struct FColumnKeys
+	{
+		uint32 DataVersion = 0;
+		TArray<double> Keys;
+	};
+
+	struct FTableState
+	{
+		TMap<int32, FColumnKeys> Columns;
+		TArray<FImGuiTableColumnSortSpec> Specs;
+		TArray<int32> Order; // empty when not sorted
+		int32 RowCount = INDEX_NONE;
+		uint32 DataVersion = 0;
+		bool bValid = false;
+	};
+
+	TMap<FName, FTableState>& GetTables()
+	{
+		static TMap<FName, FTableState> Tables;
+		return Tables;
+	}
+
+	// Merges the sorted runs Src[Begin, Mid) and Src[Mid, End) into Dst[Begin, End).
+	template<typename LessType>
+	void MergeRuns(const int32* Src, int32* Dst, int32 Begin, int32 Mid, int32 End, const LessType& Less)
+	{
+		int32 A = Begin, B = Mid, Out = Begin;
+		while (A < Mid && B < End)
+		{
+			Dst[Out++] = Less(Src[B], Src[A]) ? Src[B++] : Src[A++];
+		}
+		while (A < Mid)
+		{
+			Dst[Out++] = Src[A++];
+		}
+		while (B < End)
+		{
+			Dst[Out++] = Src[B++];
+		}
+	}
+}
+
+bool FImGuiTableSort::GetSortSpecs(TArray<FImGuiTableColumnSortSpec>& OutSpecs, bool& bOutDirty, bool bClearDirty)
+{
+	OutSpecs.Reset();
+	bOutDirty = false;
+
+	ImGuiTableSortSpecs* SortSpecs = ImGui::TableGetSortSpecs();
+	if (SortSpecs == nullptr)
+		return false;
+
+	OutSpecs.Reserve(SortSpecs->SpecsCount);
+	for (int32 i = 0; i < SortSpecs->SpecsCount; ++i)
+	{
+		const ImGuiTableColumnSortSpecs& Column = SortSpecs->Specs[i];
+		FImGuiTableColumnSortSpec& Spec = OutSpecs.AddDefaulted_GetRef();
+		Spec.ColumnIndex = Column.ColumnIndex;
+		Spec.ColumnUserID = (int32)Column.ColumnUserID;
+		Spec.SortOrder = Column.SortOrder;
+		Spec.bDescending = Column.SortDirection == ImGuiSortDirection_Descending;
+	}
+
+	bOutDirty = SortSpecs->SpecsDirty;
+	if (bClearDirty)
+	{
+		SortSpecs->SpecsDirty = false;
+	}
+	return true;
+}
+
+bool FImGuiTableSort::HasColumnKeys(FName Table, int32 Column, uint32 DataVersion, int32 NumKeys)
+{
+	const FTableState* State = GetTables().Find(Table);
+	const FColumnKeys* ColumnKeys = State ? State->Columns.Find(Column) : nullptr;
+	return ColumnKeys && ColumnKeys->DataVersion == DataVersion && ColumnKeys->Keys.Num() == NumKeys;
+}
+
+void FImGuiTableSort::SetColumnKeys(FName Table, int32 Column, uint32 DataVersion, TArray<double>&& Keys)
+{
+	// the same keys again (fed every frame) keep the current order
+	if (HasColumnKeys(Table, Column, DataVersion, Keys.Num()))
+		return;
+
+	// NaN breaks the ordering, it sorts first
+	for (double& Key : Keys)
+	{
+		if (FMath::IsNaN(Key))
+		{
+			Key = -DBL_MAX;
+		}
+	}
+
+	FTableState& State = GetTables().FindOrAdd(Table);
+	FColumnKeys& ColumnKeys = State.Columns.FindOrAdd(Column);
+	ColumnKeys.DataVersion = DataVersion;
+	ColumnKeys.Keys = MoveTemp(Keys);
+	State.bValid = false;
+}
+
+void FImGuiTableSort::SetColumnKeys(FName Table, int32 Column, uint32 DataVersion, const TArray<FString>& Keys)
+{
+	if (HasColumnKeys(Table, Column, DataVersion, Keys.Num()))
+		return;
+
+	// rank the strings once, sorting then only compares numbers
+	TArray<int32> Sorted;
+	Sorted.SetNumUninitialized(Keys.Num());
+	for (int32 i = 0; i < Keys.Num(); ++i)
+	{
+		Sorted[i] = i;
+	}
+	Algo::Sort(Sorted, [&Keys](int32 A, int32 B) { return Keys[A].Compare(Keys[B], ESearchCase::IgnoreCase) < 0; });
+
+	TArray<double> Ranks;
+	Ranks.SetNumUninitialized(Keys.Num());
+	int32 Rank = 0;
+	for (int32 i = 0; i < Sorted.Num(); ++i)
+	{
+		if (i > 0 && Keys[Sorted[i - 1]].Compare(Keys[Sorted[i]], ESearchCase::IgnoreCase) != 0)
+		{
+			++Rank;
+		}
+		Ranks[Sorted[i]] = Rank;
+	}
+
+	SetColumnKeys(Table, Column, DataVersion, MoveTemp(Ranks));
+}
+
+bool FImGuiTableSort::Update(FName Table, int32 RowCount, uint32 DataVersion)
+{
+	TArray<FImGuiTableColumnSortSpec> Specs;
+	bool bDirty = false;
+	GetSortSpecs(Specs, bDirty, true);
+	return Update(Table, RowCount, DataVersion, Specs);
+}
+
+bool FImGuiTableSort::Update(FName Table, int32 RowCount, uint32 DataVersion, const TArray<FImGuiTableColumnSortSpec>& Specs)
+{
+	FTableState& State = GetTables().FindOrAdd(Table);
+	RowCount = FMath::Max(0, RowCount);
+	if (State.bValid && State.RowCount == RowCount && State.DataVersion == DataVersion && State.Specs == Specs)
+		return false;
+
+	State.bValid = true;
+	State.RowCount = RowCount;
+	State.DataVersion = DataVersion;
+	State.Specs = Specs;
+
+	TArray<FImGuiTableColumnSortSpec, TInlineAllocator<8>> Ordered(Specs);
+	Ordered.StableSort([](const FImGuiTableColumnSortSpec& A, const FImGuiTableColumnSortSpec& B) { return A.SortOrder < B.SortOrder; });
+
+	// columns without keys for every row are left out of the sort
+	TArray<const TArray<double>*> Keys;
+	TArray<bool> Descending;
+	for (const FImGuiTableColumnSortSpec& Spec : Ordered)
+	{
+		const FColumnKeys* Column = State.Columns.Find(Spec.ColumnIndex);
+		if (Column && Column->Keys.Num() >= RowCount)
+		{
+			Keys.Add(&Column->Keys);
+			Descending.Add(Spec.bDescending);
+		}
+	}
+
+	State.Order.Reset();
+	if (Keys.Num() == 0 || RowCount == 0)
+		return true;
+
+	State.Order.SetNumUninitialized(RowCount);
+	for (int32 i = 0; i < RowCount; ++i)
+	{
+		State.Order[i] = i;
+	}
+	SortRows(State.Order, Keys, Descending);
+	return true;
+}
+
+void FImGuiTableSort::SortRows(TArray<int32>& Order, const TArray<const TArray<double>*>& Keys, const TArray<bool>& Descending)
+{
+	auto Less = [&Keys, &Descending](int32 A, int32 B)
+	{
+		for (int32 k = 0; k < Keys.Num(); ++k)
+		{
+			const double KeyA = (*Keys[k])[A];
+			const double KeyB = (*Keys[k])[B];
+			if (KeyA != KeyB)
+				return Descending[k] ? KeyA > KeyB : KeyA < KeyB;
+		}
+		return A < B;
+	};
+
+	const int32 Count = Order.Num();
+	const int32 NumTasks = ImPlotCache::GetNumTasks(Count, MinRowsPerTask);
+	if (NumTasks == 1)
+	{
+		Algo::Sort(Order, Less);
+		return;
+	}
+
+	// sort chunks in parallel, then merge pairs of runs until one is left
+	TArray<int32, TInlineAllocator<64>> Bounds;
+	for (int32 Task = 0; Task <= NumTasks; ++Task)
+	{
+		Bounds.Add((int64)Count * Task / NumTasks);
+	}
+
+	ParallelFor(NumTasks, [&](int32 Task)
+	{
+		TArrayView<int32> Chunk(Order.GetData() + Bounds[Task], Bounds[Task + 1] - Bounds[Task]);
+		Algo::Sort(Chunk, Less);
+	});
+
+	TArray<int32> Buffer;
+	Buffer.SetNumUninitialized(Count);
+	int32* Src = Order.GetData();
+	int32* Dst = Buffer.GetData();
+
+	while (Bounds.Num() > 2)
+	{
+		const int32 NumRuns = Bounds.Num() - 1;
+		ParallelFor((NumRuns + 1) / 2, [&](int32 Pair)
+		{
+			const int32 Begin = Bounds[Pair * 2];
+			const int32 Mid = Bounds[Pair * 2 + 1];
+			const int32 End = Pair * 2 + 2 < Bounds.Num() ? Bounds[Pair * 2 + 2] : Mid;
+			MergeRuns(Src, Dst, Begin, Mid, End, Less);
+		});
+
+		TArray<int32, TInlineAllocator<64>> Merged;
+		for (int32 i = 0; i < Bounds.Num(); i += 2)
+		{
+			Merged.Add(Bounds[i]);
+		}
+		if (Merged.Last() != Count)
+		{
+			Merged.Add(Count);
+		}
+		Bounds = MoveTemp(Merged);
+		Swap(Src, Dst);
+	}
+
+	if (Src != Order.GetData())
+	{
+		FMemory::Memcpy(Order.GetData(), Src, Count * sizeof(int32));
+	}
+}
+
+int32 FImGuiTableSort::GetRow(FName Table, int32 DisplayIndex)
+{
+	const TArray<int32>* Order = GetOrder(Table);
+	return Order && Order->IsValidIndex(DisplayIndex) ? (*Order)[DisplayIndex] : DisplayIndex;
+}
+
+const TArray<int32>* FImGuiTableSort::GetOrder(FName Table)
+{
+	const FTableState* State = GetTables().Find(Table);
+	return State && State->Order.Num() > 0 ? &State->Order : nullptr;
+}
+
+void FImGuiTableSort::Remove(FName Table)
+{
+	GetTables().Remove(Table);
+}
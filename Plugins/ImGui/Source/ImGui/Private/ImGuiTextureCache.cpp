@@ -0,0 +1,90 @@
+// Distributed under the MIT License (MIT) (see accompanying LICENSE file)
+
+
+#include "ImGuiTextureCache.h"
+
+#include "Modules/ModuleManager.h"
+#include "UObject/UObjectGlobals.h"
+
+namespace
+{
+	bool IsImGuiModuleLoaded()
+	{
+		return FModuleManager::Get().IsModuleLoaded(TEXT("ImGui"));
+	}
+}
+
+FImGuiTextureCache& FImGuiTextureCache::Get()
+{
+	static FImGuiTextureCache Instance;
+	return Instance;
+}
+
+FImGuiTextureCache::FImGuiTextureCache()
+{
+	PostGarbageCollectHandle = FCoreUObjectDelegates::GetPostGarbageCollect().AddRaw(this, &FImGuiTextureCache::ReleaseStale);
+}
+
+FImGuiTextureCache::~FImGuiTextureCache()
+{
+	// runs when the module is unloaded (or hot reloaded), the delegate outlives this code
+	FCoreUObjectDelegates::GetPostGarbageCollect().Remove(PostGarbageCollectHandle);
+}
+
+FImGuiTextureHandle FImGuiTextureCache::FindOrRegister(UTexture2D* Texture)
+{
+	if (Texture == nullptr)
+		return FImGuiTextureHandle();
+
+	if (const FImGuiTextureHandle* Handle = Handles.Find(Texture))
+		return *Handle;
+
+	const FName Name(*Texture->GetPathName());
+	FImGuiTextureHandle Handle = FImGuiModule::Get().FindTextureHandle(Name);
+	if (!Handle.IsValid())
+	{
+		Handle = FImGuiModule::Get().RegisterTexture(Name, Texture);
+	}
+	Handles.Add(Texture, Handle);
+	return Handle;
+}
+
+const FImGuiTextureHandle& FImGuiTextureCache::Resolve(FImGuiTexture& Texture)
+{
+	if (Texture.Generation != Generation || !Texture.Handle.IsValid())
+	{
+		Texture.Handle = FindOrRegister(Texture.Texture.Get());
+		Texture.Generation = Generation;
+	}
+	return Texture.Handle;
+}
+
+void FImGuiTextureCache::Release(UTexture2D* Texture)
+{
+	FImGuiTextureHandle Handle;
+	if (Texture != nullptr && Handles.RemoveAndCopyValue(Texture, Handle))
+	{
+		++Generation;
+		if (Handle.IsValid() && IsImGuiModuleLoaded())
+		{
+			FImGuiModule::Get().ReleaseTexture(Handle);
+		}
+	}
+}
+
+void FImGuiTextureCache::ReleaseStale()
+{
+	const bool bModuleLoaded = IsImGuiModuleLoaded();
+	for (auto It = Handles.CreateIterator(); It; ++It)
+	{
+		if (It.Key().IsValid())
+			continue;
+
+		if (It.Value().IsValid() && bModuleLoaded)
+		{
+			FImGuiModule::Get().ReleaseTexture(It.Value());
+		}
+		It.RemoveCurrent();
+		++Generation;
+	}
+}
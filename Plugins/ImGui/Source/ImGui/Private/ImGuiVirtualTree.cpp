@@ -0,0 +1,380 @@
+// Distributed under the MIT License (MIT) (see accompanying LICENSE file)
+
+
+#include "ImGuiVirtualTree.h"
+
+#include <imgui.h>
+
+namespace
+{
+	void SetUtf8(TArray<ANSICHAR>& Out, const FString& Text)
+	{
+		FTCHARToUTF8 Utf8(*Text);
+		Out.Reset(Utf8.Length() + 1);
+		Out.Append(Utf8.Get(), Utf8.Length());
+		Out.Add('\0');
+	}
+}
+
+FImGuiVirtualTree::FImGuiVirtualTree()
+{
+	Reset();
+}
+
+void FImGuiVirtualTree::Reset()
+{
+	Nodes.Reset();
+	FreeNodes.Reset();
+	Rows.Reset();
+	NumUsed = 0;
+	bRowsDirty = false;
+	Selected = INDEX_NONE;
+
+	FNode& Root = Nodes.AddDefaulted_GetRef();
+	Root.Depth = -1;
+	Root.bUsed = true;
+	Root.bExpanded = true;
+	Root.bPopulated = true;
+}
+
+void FImGuiVirtualTree::Reserve(int32 NumNodes)
+{
+	Nodes.Reserve(NumNodes + 1);
+}
+
+template<typename FuncType>
+void FImGuiVirtualTree::ForEachDescendant(int32 Node, bool bExpandedOnly, FuncType Func) const
+{
+	// pre-order walk over the sibling links, no stack needed
+	int32 Current = Nodes[Node].FirstChild;
+	while (Current != INDEX_NONE)
+	{
+		Func(Current);
+
+		const FNode& Entry = Nodes[Current];
+		if (Entry.FirstChild != INDEX_NONE && (Entry.bExpanded || !bExpandedOnly))
+		{
+			Current = Entry.FirstChild;
+			continue;
+		}
+		while (Current != Node && Nodes[Current].NextSibling == INDEX_NONE)
+		{
+			Current = Nodes[Current].Parent;
+		}
+		Current = Current == Node ? INDEX_NONE : Nodes[Current].NextSibling;
+	}
+}
+
+bool FImGuiVirtualTree::HasRow(int32 Node) const
+{
+	for (int32 Parent = Nodes[Node].Parent; Parent > 0; Parent = Nodes[Parent].Parent)
+	{
+		if (!Nodes[Parent].bExpanded)
+			return false;
+	}
+	return true;
+}
+
+int32 FImGuiVirtualTree::FindRow(int32 Node, int32 RowHint) const
+{
+	return Rows.IsValidIndex(RowHint) && Rows[RowHint] == Node ? RowHint : Rows.Find(Node);
+}
+
+void FImGuiVirtualTree::RemoveRows(int32 Row, int32 Depth)
+{
+	// the rows of a subtree follow each other, deeper than the subtree root
+	int32 End = Row;
+	while (End < Rows.Num() && Nodes[Rows[End]].Depth > Depth)
+	{
+		++End;
+	}
+	Rows.RemoveAt(Row, End - Row, false);
+}
+
+int32 FImGuiVirtualTree::AddNode(int32 Parent, const FString& Label, bool bHasChildren, int32 UserValue)
+{
+	if (Parent == INDEX_NONE)
+	{
+		Parent = 0;
+	}
+	else if (!IsValidNode(Parent))
+	{
+		return INDEX_NONE;
+	}
+
+	const int32 Node = FreeNodes.Num() > 0 ? FreeNodes.Pop(false) : Nodes.AddDefaulted();
+	FNode& Entry = Nodes[Node];
+	Entry = FNode();
+	Entry.Parent = Parent;
+	Entry.Depth = Nodes[Parent].Depth + 1;
+	Entry.UserValue = UserValue;
+	Entry.bUsed = true;
+	Entry.bHasChildren = bHasChildren;
+	SetUtf8(Entry.Label, Label);
+
+	FNode& ParentEntry = Nodes[Parent];
+	Entry.PrevSibling = ParentEntry.LastChild;
+	if (ParentEntry.LastChild != INDEX_NONE)
+	{
+		Nodes[ParentEntry.LastChild].NextSibling = Node;
+	}
+	else
+	{
+		ParentEntry.FirstChild = Node;
+	}
+	ParentEntry.LastChild = Node;
+	++NumUsed;
+
+	if (ParentEntry.bExpanded && !bRowsDirty && HasRow(Parent))
+	{
+		// the last root node is the last row, anything else waits for a single re-flatten
+		if (Parent == 0)
+		{
+			Rows.Add(Node);
+		}
+		else
+		{
+			bRowsDirty = true;
+		}
+	}
+	return Node;
+}
+
+void FImGuiVirtualTree::Unlink(int32 Node)
+{
+	FNode& Entry = Nodes[Node];
+	FNode& ParentEntry = Nodes[Entry.Parent];
+	if (Entry.PrevSibling != INDEX_NONE)
+	{
+		Nodes[Entry.PrevSibling].NextSibling = Entry.NextSibling;
+	}
+	else
+	{
+		ParentEntry.FirstChild = Entry.NextSibling;
+	}
+	if (Entry.NextSibling != INDEX_NONE)
+	{
+		Nodes[Entry.NextSibling].PrevSibling = Entry.PrevSibling;
+	}
+	else
+	{
+		ParentEntry.LastChild = Entry.PrevSibling;
+	}
+	Entry.Parent = Entry.PrevSibling = Entry.NextSibling = INDEX_NONE;
+}
+
+void FImGuiVirtualTree::FreeSubtree(int32 Node)
+{
+	TArray<int32> Freed;
+	Freed.Add(Node);
+	ForEachDescendant(Node, false, [&Freed](int32 Descendant) { Freed.Add(Descendant); });
+
+	for (const int32 Index : Freed)
+	{
+		Nodes[Index] = FNode();
+		if (Selected == Index)
+		{
+			Selected = INDEX_NONE;
+		}
+	}
+	FreeNodes.Append(Freed);
+	NumUsed -= Freed.Num();
+}
+
+void FImGuiVirtualTree::RemoveNode(int32 Node)
+{
+	if (!IsValidNode(Node))
+		return;
+
+	if (!bRowsDirty && HasRow(Node))
+	{
+		const int32 Row = FindRow(Node, INDEX_NONE);
+		if (Row != INDEX_NONE)
+		{
+			Rows.RemoveAt(Row, 1, false);
+			RemoveRows(Row, Nodes[Node].Depth);
+		}
+	}
+
+	Unlink(Node);
+	FreeSubtree(Node);
+}
+
+void FImGuiVirtualTree::RemoveChildren(int32 Node)
+{
+	if (Node == INDEX_NONE)
+	{
+		Reset();
+		return;
+	}
+	if (!IsValidNode(Node))
+		return;
+
+	if (!bRowsDirty && Nodes[Node].bExpanded && HasRow(Node))
+	{
+		const int32 Row = FindRow(Node, INDEX_NONE);
+		if (Row != INDEX_NONE)
+		{
+			RemoveRows(Row + 1, Nodes[Node].Depth);
+		}
+	}
+
+	while (Nodes[Node].FirstChild != INDEX_NONE)
+	{
+		const int32 Child = Nodes[Node].FirstChild;
+		Unlink(Child);
+		FreeSubtree(Child);
+	}
+	Nodes[Node].bPopulated = false;
+}
+
+void FImGuiVirtualTree::SetLabel(int32 Node, const FString& Label)
+{
+	if (IsValidNode(Node))
+	{
+		SetUtf8(Nodes[Node].Label, Label);
+	}
+}
+
+void FImGuiVirtualTree::SetExpandedAt(int32 Node, bool bExpanded, int32 RowHint)
+{
+	if (!IsValidNode(Node) || Nodes[Node].bExpanded == bExpanded)
+		return;
+
+	if (bExpanded && Nodes[Node].bHasChildren && !Nodes[Node].bPopulated)
+	{
+		// children added here don't touch the rows yet, the node is still collapsed
+		Nodes[Node].bPopulated = true;
+		if (OnPopulate)
+		{
+			OnPopulate(Node);
+		}
+		if (!IsValidNode(Node))
+			return;
+	}
+	Nodes[Node].bExpanded = bExpanded;
+
+	if (bRowsDirty || !HasRow(Node))
+		return;
+
+	const int32 Row = FindRow(Node, RowHint);
+	if (Row == INDEX_NONE)
+		return;
+
+	if (bExpanded)
+	{
+		TArray<int32> Inserted;
+		ForEachDescendant(Node, true, [&Inserted](int32 Descendant) { Inserted.Add(Descendant); });
+		Rows.Insert(Inserted, Row + 1);
+	}
+	else
+	{
+		RemoveRows(Row + 1, Nodes[Node].Depth);
+	}
+}
+
+void FImGuiVirtualTree::Reveal(int32 Node)
+{
+	if (!IsValidNode(Node))
+		return;
+
+	TArray<int32, TInlineAllocator<32>> Ancestors;
+	for (int32 Parent = Nodes[Node].Parent; Parent > 0; Parent = Nodes[Parent].Parent)
+	{
+		Ancestors.Add(Parent);
+	}
+	for (int32 i = Ancestors.Num() - 1; i >= 0; --i)
+	{
+		SetExpanded(Ancestors[i], true);
+	}
+}
+
+void FImGuiVirtualTree::CollapseAll()
+{
+	for (int32 Node = 1; Node < Nodes.Num(); ++Node)
+	{
+		Nodes[Node].bExpanded = false;
+	}
+	Rows.Reset();
+	ForEachDescendant(0, true, [this](int32 Node) { Rows.Add(Node); });
+	bRowsDirty = false;
+}
+
+const TArray<int32>& FImGuiVirtualTree::GetVisibleRows()
+{
+	if (bRowsDirty)
+	{
+		Rows.Reset();
+		ForEachDescendant(0, true, [this](int32 Node) { Rows.Add(Node); });
+		bRowsDirty = false;
+	}
+	return Rows;
+}
+
+bool FImGuiVirtualTree::Draw(const TFunction<void(int32 Node)>& DrawRow, bool bTableRows)
+{
+	const TArray<int32>& VisibleRows = GetVisibleRows();
+	const float IndentSpacing = ImGui::GetStyle().IndentSpacing;
+
+	// expanding or collapsing changes the rows, it is applied after the loop
+	int32 ToggledNode = INDEX_NONE;
+	int32 ToggledRow = INDEX_NONE;
+	bool bSelectionChanged = false;
+
+	ImGuiListClipper Clipper;
+	Clipper.Begin(VisibleRows.Num());
+	while (Clipper.Step())
+	{
+		for (int32 Row = Clipper.DisplayStart; Row < Clipper.DisplayEnd; ++Row)
+		{
+			const int32 Node = VisibleRows[Row];
+			const FNode& Entry = Nodes[Node];
+			const bool bLeaf = Entry.IsLeaf();
+			const bool bExpanded = Entry.bExpanded;
+
+			if (bTableRows)
+			{
+				ImGui::TableNextRow();
+				ImGui::TableSetColumnIndex(0);
+			}
+			ImGui::SetCursorPosX(ImGui::GetCursorPosX() + Entry.Depth * IndentSpacing);
+
+			ImGuiTreeNodeFlags Flags = ImGuiTreeNodeFlags_NoTreePushOnOpen | ImGuiTreeNodeFlags_OpenOnArrow | ImGuiTreeNodeFlags_OpenOnDoubleClick | ImGuiTreeNodeFlags_SpanFullWidth;
+			if (bLeaf)
+			{
+				Flags |= ImGuiTreeNodeFlags_Leaf;
+			}
+			if (Node == Selected)
+			{
+				Flags |= ImGuiTreeNodeFlags_Selected;
+			}
+			if (!bLeaf)
+			{
+				ImGui::SetNextItemOpen(bExpanded, ImGuiCond_Always);
+			}
+
+			const bool bOpen = ImGui::TreeNodeEx((void*)(intptr_t)Node, Flags, "%s", Entry.Label.GetData());
+			if (!bLeaf && bOpen != bExpanded)
+			{
+				ToggledNode = Node;
+				ToggledRow = Row;
+			}
+			if (ImGui::IsItemClicked() && !ImGui::IsItemToggledOpen() && Selected != Node)
+			{
+				Selected = Node;
+				bSelectionChanged = true;
+			}
+
+			if (DrawRow)
+			{
+				DrawRow(Node);
+			}
+		}
+	}
+
+	if (ToggledNode != INDEX_NONE)
+	{
+		SetExpandedAt(ToggledNode, !Nodes[ToggledNode].bExpanded, ToggledRow);
+	}
+	return bSelectionChanged;
+}
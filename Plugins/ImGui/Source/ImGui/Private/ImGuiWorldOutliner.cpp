@@ -0,0 +1,446 @@
+// Distributed under the MIT License (MIT) (see accompanying LICENSE file)
+
+
+#include "ImGuiWorldOutliner.h"
+
+#include "Engine/Engine.h"
+#include "Engine/Level.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+
+#include "ImGuiDelegates.h"
+#include "ImGuiModule.h"
+#include "ImGuiPropertyInspector.h"
+
+#include <imgui.h>
+
+//-----------------------------------------------------------------------------
+// Outliner
+//-----------------------------------------------------------------------------
+
+FImGuiWorldOutliner::FImGuiWorldOutliner(UWorld* InWorld)
+	: World(InWorld)
+{
+	if (InWorld == nullptr)
+		return;
+
+	ActorSpawnedHandle = InWorld->AddOnActorSpawnedHandler(FOnActorSpawned::FDelegate::CreateRaw(this, &FImGuiWorldOutliner::OnActorSpawned));
+	if (GEngine)
+	{
+		ActorDeletedHandle = GEngine->OnLevelActorDeleted().AddRaw(this, &FImGuiWorldOutliner::OnActorDeleted);
+	}
+	LevelAddedHandle = FWorldDelegates::LevelAddedToWorld.AddRaw(this, &FImGuiWorldOutliner::OnLevelAdded);
+	LevelRemovedHandle = FWorldDelegates::LevelRemovedFromWorld.AddRaw(this, &FImGuiWorldOutliner::OnLevelRemoved);
+
+	for (ULevel* Level : InWorld->GetLevels())
+	{
+		PendingLevels.Add(Level);
+	}
+}
+
+FImGuiWorldOutliner::~FImGuiWorldOutliner()
+{
+	if (UWorld* CurrentWorld = World.Get())
+	{
+		CurrentWorld->RemoveOnActorSpawnedHandler(ActorSpawnedHandle);
+	}
+	if (GEngine)
+	{
+		GEngine->OnLevelActorDeleted().Remove(ActorDeletedHandle);
+	}
+	FWorldDelegates::LevelAddedToWorld.Remove(LevelAddedHandle);
+	FWorldDelegates::LevelRemovedFromWorld.Remove(LevelRemovedHandle);
+}
+
+FString FImGuiWorldOutliner::GetLabel(const AActor* Actor)
+{
+#if WITH_EDITOR
+	return Actor->GetActorLabel();
+#else
+	return Actor->GetName();
+#endif
+}
+
+void FImGuiWorldOutliner::AddActor(AActor* Actor)
+{
+	if (Actor == nullptr || Actor->IsPendingKill() || SlotByActor.Contains(FObjectKey(Actor)))
+		return;
+
+	const int32 Slot = FreeSlots.Num() > 0 ? FreeSlots.Pop(false) : Entries.AddDefaulted();
+	FEntry& Entry = Entries[Slot];
+	Entry.Actor = Actor;
+	Entry.Key = FObjectKey(Actor);
+	Entry.Level = FObjectKey(Actor->GetLevel());
+	Entry.Class = Actor->GetClass();
+	Entry.Label = GetLabel(Actor);
+	Entry.bAlive = true;
+
+	SlotByActor.Add(Entry.Key, Slot);
+	++ClassCounts.FindOrAdd(Entry.Class);
+	NameIndex.SetRow(Slot, Entry.Label);
+	++NumAlive;
+	++Version;
+}
+
+void FImGuiWorldOutliner::RemoveSlot(int32 Slot)
+{
+	FEntry& Entry = Entries[Slot];
+	if (!Entry.bAlive)
+		return;
+
+	SlotByActor.Remove(Entry.Key);
+	if (int32* Count = ClassCounts.Find(Entry.Class))
+	{
+		if (--*Count <= 0)
+		{
+			ClassCounts.Remove(Entry.Class);
+		}
+	}
+	NameIndex.RemoveRow(Slot);
+
+	if (Selected == Slot)
+	{
+		Selected = INDEX_NONE;
+	}
+	Entry = FEntry();
+	FreeSlots.Add(Slot);
+	--NumAlive;
+	++Version;
+}
+
+void FImGuiWorldOutliner::OnActorSpawned(AActor* Actor)
+{
+	AddActor(Actor);
+}
+
+void FImGuiWorldOutliner::OnActorDeleted(AActor* Actor)
+{
+	if (const int32* Slot = SlotByActor.Find(FObjectKey(Actor)))
+	{
+		RemoveSlot(*Slot);
+	}
+}
+
+void FImGuiWorldOutliner::OnLevelAdded(ULevel* Level, UWorld* InWorld)
+{
+	if (InWorld == World.Get() && Level)
+	{
+		PendingLevels.AddUnique(Level);
+	}
+}
+
+void FImGuiWorldOutliner::OnLevelRemoved(ULevel* Level, UWorld* InWorld)
+{
+	if (InWorld != World.Get())
+		return;
+
+	// a null level means all of them
+	if (Level == nullptr)
+	{
+		PendingLevels.Reset();
+		ScanIndex = 0;
+	}
+	else if (PendingLevels.Num() > 0 && PendingLevels[0] == Level)
+	{
+		PendingLevels.RemoveAt(0);
+		ScanIndex = 0;
+	}
+	else
+	{
+		PendingLevels.Remove(Level);
+	}
+
+	// the actors go with the level, rather than lingering until validation finds them
+	const FObjectKey LevelKey(Level);
+	for (int32 Slot = 0; Slot < Entries.Num(); ++Slot)
+	{
+		if (Entries[Slot].bAlive && (Level == nullptr || Entries[Slot].Level == LevelKey))
+		{
+			RemoveSlot(Slot);
+		}
+	}
+}
+
+void FImGuiWorldOutliner::Update(double BudgetMs)
+{
+	const double EndTime = FPlatformTime::Seconds() + BudgetMs * 0.001;
+	int32 Items = 0;
+	auto OutOfTime = [&]()
+	{
+		return ++Items % ItemsPerTimeCheck == 0 && FPlatformTime::Seconds() > EndTime;
+	};
+
+	// scan the levels added since the start, resuming in the middle of a level
+	while (PendingLevels.Num() > 0)
+	{
+		ULevel* Level = PendingLevels[0].Get();
+		if (Level == nullptr)
+		{
+			PendingLevels.RemoveAt(0);
+			ScanIndex = 0;
+			continue;
+		}
+
+		for (; ScanIndex < Level->Actors.Num(); ++ScanIndex)
+		{
+			if (OutOfTime())
+				return;
+			AddActor(Level->Actors[ScanIndex]);
+		}
+		PendingLevels.RemoveAt(0);
+		ScanIndex = 0;
+	}
+
+	// at most one validation pass per frame
+	for (int32 Checked = 0; Checked < Entries.Num(); ++Checked)
+	{
+		if (OutOfTime())
+			return;
+
+		ValidateCursor = ValidateCursor < Entries.Num() ? ValidateCursor : 0;
+		FEntry& Entry = Entries[ValidateCursor];
+		if (Entry.bAlive)
+		{
+			const AActor* Actor = Entry.Actor.Get();
+			if (Actor == nullptr || Actor->IsPendingKill())
+			{
+				RemoveSlot(ValidateCursor);
+			}
+			else
+			{
+				FString Label = GetLabel(Actor);
+				if (!Label.Equals(Entry.Label, ESearchCase::CaseSensitive))
+				{
+					Entry.Label = MoveTemp(Label);
+					NameIndex.SetRow(ValidateCursor, Entry.Label);
+					++Version;
+				}
+			}
+		}
+		++ValidateCursor;
+	}
+}
+
+AActor* FImGuiWorldOutliner::GetSelected() const
+{
+	return Entries.IsValidIndex(Selected) ? Entries[Selected].Actor.Get() : nullptr;
+}
+
+void FImGuiWorldOutliner::SetFilter(const FString& InQuery, UClass* Class)
+{
+	if (InQuery != Query || Class != FilterClass.Get() || FilterClass.IsStale())
+	{
+		Query = InQuery;
+		FilterClass = Class;
+		bFilterDirty = true;
+	}
+}
+
+const TArray<int32>& FImGuiWorldOutliner::GetFilteredSlots()
+{
+	if (!bFilterDirty && FilteredVersion == Version)
+		return Filtered;
+
+	// the name index narrows extended queries by itself, the class filter runs on its result
+	const TArray<int32>& Matches = NameIndex.Find(Query);
+	Filtered.Reset(Matches.Num());
+	for (const int32 Slot : Matches)
+	{
+		if (Entries[Slot].bAlive && (FilterClass.IsExplicitlyNull() || Entries[Slot].Class == FilterClass))
+		{
+			Filtered.Add(Slot);
+		}
+	}
+
+	FilteredVersion = Version;
+	bFilterDirty = false;
+	return Filtered;
+}
+
+void FImGuiWorldOutliner::DrawClassFilter()
+{
+	// a class collected meanwhile (a recompiled blueprint) falls back to all classes
+	UClass* Current = FilterClass.Get();
+	if (Current == nullptr && FilterClass.IsStale())
+	{
+		SetFilter(Query, nullptr);
+	}
+
+	const FString Preview = Current ? Current->GetName() : TEXT("All classes");
+	if (!ImGui::BeginCombo("##class", TCHAR_TO_UTF8(*Preview)))
+		return;
+
+	if (ImGui::Selectable("All classes", Current == nullptr))
+	{
+		SetFilter(Query, nullptr);
+	}
+
+	TArray<TPair<UClass*, int32>> Classes;
+	for (const TPair<TWeakObjectPtr<UClass>, int32>& Class : ClassCounts)
+	{
+		if (UClass* Key = Class.Key.Get())
+		{
+			Classes.Emplace(Key, Class.Value);
+		}
+	}
+	Classes.Sort([](const TPair<UClass*, int32>& A, const TPair<UClass*, int32>& B) { return A.Value > B.Value; });
+
+	for (const TPair<UClass*, int32>& Class : Classes)
+	{
+		const FString Label = FString::Printf(TEXT("%s (%d)"), *Class.Key->GetName(), Class.Value);
+		if (ImGui::Selectable(TCHAR_TO_UTF8(*Label), Current == Class.Key))
+		{
+			SetFilter(Query, Class.Key);
+		}
+	}
+	ImGui::EndCombo();
+}
+
+void FImGuiWorldOutliner::DrawRows()
+{
+	const ImGuiTableFlags Flags = ImGuiTableFlags_ScrollY | ImGuiTableFlags_RowBg | ImGuiTableFlags_Resizable | ImGuiTableFlags_BordersInnerV;
+	if (!ImGui::BeginTable("##actors", 2, Flags))
+		return;
+
+	ImGui::TableSetupScrollFreeze(0, 1);
+	ImGui::TableSetupColumn("Actor");
+	ImGui::TableSetupColumn("Class");
+	ImGui::TableHeadersRow();
+
+	// actors destroyed since the last validation are not drawn, and dropped after the table
+	TArray<int32, TInlineAllocator<16>> Stale;
+
+	const TArray<int32>& Slots = GetFilteredSlots();
+	ImGuiListClipper Clipper;
+	Clipper.Begin(Slots.Num());
+	while (Clipper.Step())
+	{
+		for (int32 Row = Clipper.DisplayStart; Row < Clipper.DisplayEnd; ++Row)
+		{
+			const int32 Slot = Slots[Row];
+			const FEntry& Entry = Entries[Slot];
+
+			ImGui::TableNextRow();
+			ImGui::TableNextColumn();
+			const AActor* Actor = Entry.Actor.Get();
+			if (Actor == nullptr || Actor->IsPendingKill())
+			{
+				ImGui::TextDisabled("(destroyed)");
+				Stale.Add(Slot);
+				continue;
+			}
+
+			ImGui::PushID(Slot);
+			if (ImGui::Selectable(TCHAR_TO_UTF8(*Entry.Label), Selected == Slot, ImGuiSelectableFlags_SpanAllColumns))
+			{
+				Selected = Slot;
+			}
+			ImGui::PopID();
+
+			ImGui::TableNextColumn();
+			ImGui::TextUnformatted(TCHAR_TO_UTF8(*Actor->GetClass()->GetName()));
+		}
+	}
+	ImGui::EndTable();
+
+	for (const int32 Slot : Stale)
+	{
+		RemoveSlot(Slot);
+	}
+}
+
+void FImGuiWorldOutliner::DrawDetails()
+{
+	AActor* Actor = GetSelected();
+	if (Actor == nullptr)
+	{
+		ImGui::TextDisabled("No actor selected");
+		return;
+	}
+
+	ImGui::TextUnformatted(TCHAR_TO_UTF8(*GetLabel(Actor)));
+	ImGui::Separator();
+	FImGuiPropertyInspector::DrawObject(Actor);
+}
+
+void FImGuiWorldOutliner::Draw(const char* WindowName, bool* bOpen, bool bShowDetails)
+{
+	if (!ImGui::Begin(WindowName, bOpen))
+	{
+		ImGui::End();
+		return;
+	}
+
+	ImGui::SetNextItemWidth(ImGui::GetFontSize() * 16.0f);
+	if (ImGui::InputTextWithHint("##filter", "Filter", FilterText, UE_ARRAY_COUNT(FilterText)))
+	{
+		SetFilter(UTF8_TO_TCHAR(FilterText), FilterClass);
+	}
+	ImGui::SameLine();
+	ImGui::SetNextItemWidth(ImGui::GetFontSize() * 16.0f);
+	DrawClassFilter();
+	ImGui::SameLine();
+	ImGui::Text("%d / %d actors", GetFilteredSlots().Num(), NumAlive);
+	if (PendingLevels.Num() > 0)
+	{
+		ImGui::SameLine();
+		ImGui::TextDisabled("(scanning %d levels)", PendingLevels.Num());
+	}
+
+	if (bShowDetails)
+	{
+		const float ListWidth = ImGui::GetContentRegionAvail().x * 0.5f;
+		ImGui::BeginChild("##list", ImVec2(ListWidth, 0.0f));
+		DrawRows();
+		ImGui::EndChild();
+		ImGui::SameLine();
+		ImGui::BeginChild("##details", ImVec2(0.0f, 0.0f), true);
+		DrawDetails();
+		ImGui::EndChild();
+	}
+	else
+	{
+		DrawRows();
+	}
+
+	ImGui::End();
+}
+
+//-----------------------------------------------------------------------------
+// Component
+//-----------------------------------------------------------------------------
+
+UImGuiWorldOutlinerComponent::UImGuiWorldOutlinerComponent()
+{
+	PrimaryComponentTick.bCanEverTick = false;
+}
+
+void UImGuiWorldOutlinerComponent::BeginPlay()
+{
+	Super::BeginPlay();
+
+	Outliner = MakeUnique<FImGuiWorldOutliner>(GetWorld());
+	ImGuiTickHandle = FImGuiDelegates::OnWorldDebug().AddUObject(this, &UImGuiWorldOutlinerComponent::ImGuiTick);
+}
+
+void UImGuiWorldOutlinerComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	FImGuiDelegates::OnWorldDebug().Remove(ImGuiTickHandle);
+	Outliner.Reset();
+
+	Super::EndPlay(EndPlayReason);
+}
+
+void UImGuiWorldOutlinerComponent::ImGuiTick()
+{
+	if (!Outliner)
+		return;
+
+	// the snapshot keeps up even while the window is hidden
+	Outliner->Update(TimeBudgetMs);
+
+	if (!bOpen || !FImGuiModule::Get().GetProperties().IsInputEnabled())
+		return;
+
+	Outliner->Draw(TCHAR_TO_UTF8(*WindowName), &bOpen, bShowDetails);
+}
@@ -0,0 +1,342 @@
+// Distributed under the MIT License (MIT) (see accompanying LICENSE file)
+
+
+#include "ImGuiWorldOverlay.h"
+
+#include "Async/ParallelFor.h"
+#include "Engine/GameViewportClient.h"
+#include "Engine/LocalPlayer.h"
+#include "GameFramework/PlayerController.h"
+#include "Kismet/GameplayStatics.h"
+#include "SceneView.h"
+#include "UnrealClient.h"
+
+#include "ImplotCache.h"
+#include "ImplotSoACache.h"
+
+namespace
+{
+	constexpr ImU32 DefaultColor = IM_COL32_WHITE;
+
+	struct FLabelCandidate
+	{
+		int32 Item;
+		FVector2D Anchor; // bottom center of the label
+		float Depth;
+	};
+
+	FORCEINLINE ImU32 GetColor(const ImU32* Colors, int32 NumColors, int32 Index)
+	{
+		return NumColors > 0 ? Colors[FMath::Min(Index, NumColors - 1)] : DefaultColor;
+	}
+
+	// Draws the labels nearest first. With #bDeclutter, a label is dropped if its rect touches a grid cell taken by an earlier one.
+	void DrawLabels(ImDrawList* DrawList, const FImGuiOverlayView& View, TArray<FLabelCandidate>& Candidates, const FString* Labels,
+		const ImU32* Colors, int32 NumColors, bool bDeclutter)
+	{
+		if (Candidates.Num() == 0)
+			return;
+
+		Candidates.Sort([](const FLabelCandidate& A, const FLabelCandidate& B) { return A.Depth < B.Depth; });
+
+		const float Cell = FImGuiWorldOverlay::GridCellSize;
+		const int32 GridWidth = FMath::Max(1, FMath::CeilToInt(View.ScreenSize.X / Cell));
+		const int32 GridHeight = FMath::Max(1, FMath::CeilToInt(View.ScreenSize.Y / Cell));
+		TBitArray<> Occupied(false, bDeclutter ? GridWidth * GridHeight : 0);
+
+		for (const FLabelCandidate& Candidate : Candidates)
+		{
+			const FString& Label = Labels[Candidate.Item];
+			if (Label.IsEmpty())
+				continue;
+
+			const FTCHARToUTF8 Text(*Label);
+			const ImVec2 Size = ImGui::CalcTextSize(Text.Get(), Text.Get() + Text.Length());
+			const ImVec2 Pos(Candidate.Anchor.X - Size.x * 0.5f, Candidate.Anchor.Y - Size.y);
+
+			if (bDeclutter)
+			{
+				const int32 X0 = FMath::Clamp(FMath::FloorToInt((Pos.x - View.ScreenMin.X) / Cell), 0, GridWidth - 1);
+				const int32 Y0 = FMath::Clamp(FMath::FloorToInt((Pos.y - View.ScreenMin.Y) / Cell), 0, GridHeight - 1);
+				const int32 X1 = FMath::Clamp(FMath::FloorToInt((Pos.x + Size.x - View.ScreenMin.X) / Cell), 0, GridWidth - 1);
+				const int32 Y1 = FMath::Clamp(FMath::FloorToInt((Pos.y + Size.y - View.ScreenMin.Y) / Cell), 0, GridHeight - 1);
+
+				bool bFree = true;
+				for (int32 Y = Y0; Y <= Y1 && bFree; ++Y)
+				{
+					for (int32 X = X0; X <= X1 && bFree; ++X)
+					{
+						bFree = !Occupied[Y * GridWidth + X];
+					}
+				}
+				if (!bFree)
+					continue;
+
+				for (int32 Y = Y0; Y <= Y1; ++Y)
+				{
+					for (int32 X = X0; X <= X1; ++X)
+					{
+						Occupied[Y * GridWidth + X] = true;
+					}
+				}
+			}
+
+			DrawList->AddText(Pos, GetColor(Colors, NumColors, Candidate.Item), Text.Get(), Text.Get() + Text.Length());
+		}
+	}
+}
+
+bool FImGuiOverlayView::FromPlayer(const APlayerController* Player, FImGuiOverlayView& OutView)
+{
+	const ULocalPlayer* LocalPlayer = Player != nullptr ? Player->GetLocalPlayer() : nullptr;
+	if (LocalPlayer == nullptr || LocalPlayer->ViewportClient == nullptr || LocalPlayer->ViewportClient->Viewport == nullptr)
+		return false;
+
+	FViewport* Viewport = LocalPlayer->ViewportClient->Viewport;
+	FSceneViewProjectionData ProjectionData;
+	if (!LocalPlayer->GetProjectionData(Viewport, eSSP_FULL, ProjectionData))
+		return false;
+
+	OutView.ViewProjection = ProjectionData.ComputeViewProjectionMatrix();
+	OutView.ViewOrigin = ProjectionData.ViewOrigin;
+
+	// the view rect is in viewport pixels, ImGui may use a different display size
+	const FIntRect ViewRect = ProjectionData.GetConstrainedViewRect();
+	const FIntPoint ViewportSize = Viewport->GetSizeXY();
+	const ImVec2 DisplaySize = ImGui::GetIO().DisplaySize;
+	const FVector2D Scale(ViewportSize.X > 0 ? DisplaySize.x / ViewportSize.X : 1.0f, ViewportSize.Y > 0 ? DisplaySize.y / ViewportSize.Y : 1.0f);
+	OutView.ScreenMin = FVector2D(ViewRect.Min) * Scale;
+	OutView.ScreenSize = FVector2D(ViewRect.Size()) * Scale;
+	return OutView.ScreenSize.X > 0.0f && OutView.ScreenSize.Y > 0.0f;
+}
+
+void FImGuiWorldOverlay::Project(const FImGuiOverlayView& View, const FVector* Positions, int32 Count, float MaxDistance, float Margin,
+	TArray<FVector2D>& OutScreen, TArray<float>& OutDepth, TArray<uint8>& OutFlags)
+{
+	OutScreen.SetNumUninitialized(Count, false);
+	OutDepth.SetNumUninitialized(Count, false);
+	OutFlags.SetNumUninitialized(Count, false);
+	if (Count <= 0)
+		return;
+
+	// one component per array, so four positions fill a register per component
+	TArray<float> Components;
+	Components.SetNumUninitialized(Count * 3);
+	float* Xs = Components.GetData();
+	float* Ys = Xs + Count;
+	float* Zs = Ys + Count;
+	FVector BoundsMin, BoundsMax;
+	FImPlotSoACache::Transpose(Positions, Count, Xs, Ys, Zs, BoundsMin, BoundsMax);
+
+	const FMatrix& M = View.ViewProjection;
+	const float Limit = 1.0f + Margin;
+	const float MaxDistanceSq = MaxDistance > 0.0f ? FMath::Square(MaxDistance) : MAX_flt;
+	const FVector2D Half = View.ScreenSize * 0.5f;
+	const FVector2D Center = View.ScreenMin + Half;
+
+	FVector2D* Screen = OutScreen.GetData();
+	float* Depth = OutDepth.GetData();
+	uint8* Flags = OutFlags.GetData();
+
+	const int32 NumTasks = ImPlotCache::GetNumTasks(Count, MinPositionsPerTask);
+	ParallelFor(NumTasks, [&](int32 Task)
+	{
+		const int32 Begin = (int64)Count * Task / NumTasks;
+		const int32 End = (int64)Count * (Task + 1) / NumTasks;
+
+		const VectorRegister M00 = VectorSetFloat1(M.M[0][0]), M10 = VectorSetFloat1(M.M[1][0]), M20 = VectorSetFloat1(M.M[2][0]), M30 = VectorSetFloat1(M.M[3][0]);
+		const VectorRegister M01 = VectorSetFloat1(M.M[0][1]), M11 = VectorSetFloat1(M.M[1][1]), M21 = VectorSetFloat1(M.M[2][1]), M31 = VectorSetFloat1(M.M[3][1]);
+		const VectorRegister M03 = VectorSetFloat1(M.M[0][3]), M13 = VectorSetFloat1(M.M[1][3]), M23 = VectorSetFloat1(M.M[2][3]), M33 = VectorSetFloat1(M.M[3][3]);
+		const VectorRegister OriginX = VectorSetFloat1(View.ViewOrigin.X), OriginY = VectorSetFloat1(View.ViewOrigin.Y), OriginZ = VectorSetFloat1(View.ViewOrigin.Z);
+		const VectorRegister VEpsilon = VectorSetFloat1(KINDA_SMALL_NUMBER);
+		const VectorRegister VLimit = VectorSetFloat1(Limit);
+		const VectorRegister VMaxDistanceSq = VectorSetFloat1(MaxDistanceSq);
+		const VectorRegister HalfX = VectorSetFloat1(Half.X), HalfY = VectorSetFloat1(-Half.Y);
+		const VectorRegister CenterX = VectorSetFloat1(Center.X), CenterY = VectorSetFloat1(Center.Y);
+		alignas(16) float ScreenX[4], ScreenY[4];
+
+		int32 i = Begin;
+		for (; i + 4 <= End; i += 4)
+		{
+			const VectorRegister X = VectorLoad(Xs + i);
+			const VectorRegister Y = VectorLoad(Ys + i);
+			const VectorRegister Z = VectorLoad(Zs + i);
+
+			// row vector times matrix, only the clip X, Y and W rows are needed
+			const VectorRegister ClipX = VectorMultiplyAdd(X, M00, VectorMultiplyAdd(Y, M10, VectorMultiplyAdd(Z, M20, M30)));
+			const VectorRegister ClipY = VectorMultiplyAdd(X, M01, VectorMultiplyAdd(Y, M11, VectorMultiplyAdd(Z, M21, M31)));
+			const VectorRegister ClipW = VectorMultiplyAdd(X, M03, VectorMultiplyAdd(Y, M13, VectorMultiplyAdd(Z, M23, M33)));
+
+			// lanes behind the camera get garbage coordinates, their flags hide them
+			const VectorRegister InvW = VectorDivide(VectorOne(), VectorMax(ClipW, VEpsilon));
+			const VectorRegister NdcX = VectorMultiply(ClipX, InvW);
+			const VectorRegister NdcY = VectorMultiply(ClipY, InvW);
+
+			const VectorRegister DX = VectorSubtract(X, OriginX);
+			const VectorRegister DY = VectorSubtract(Y, OriginY);
+			const VectorRegister DZ = VectorSubtract(Z, OriginZ);
+			const VectorRegister DistanceSq = VectorMultiplyAdd(DX, DX, VectorMultiplyAdd(DY, DY, VectorMultiply(DZ, DZ)));
+
+			const int32 FrontBits = VectorMaskBits(VectorCompareGT(ClipW, VEpsilon));
+			const int32 ViewBits = VectorMaskBits(VectorBitwiseAnd(VectorCompareLE(VectorAbs(NdcX), VLimit), VectorCompareLE(VectorAbs(NdcY), VLimit)));
+			const int32 RangeBits = VectorMaskBits(VectorCompareLE(DistanceSq, VMaxDistanceSq));
+
+			VectorStoreAligned(VectorMultiplyAdd(NdcX, HalfX, CenterX), ScreenX);
+			VectorStoreAligned(VectorMultiplyAdd(NdcY, HalfY, CenterY), ScreenY);
+			VectorStore(ClipW, Depth + i);
+
+			for (int32 k = 0; k < 4; ++k)
+			{
+				Screen[i + k] = FVector2D(ScreenX[k], ScreenY[k]);
+				Flags[i + k] = (uint8)(((FrontBits >> k) & 1) * InFront | ((ViewBits >> k) & 1) * InView | ((RangeBits >> k) & 1) * InRange);
+			}
+		}
+
+		for (; i < End; ++i)
+		{
+			const FVector P(Xs[i], Ys[i], Zs[i]);
+			const FVector4 Clip = M.TransformFVector4(FVector4(P, 1.0f));
+			const float InvW = 1.0f / FMath::Max(Clip.W, KINDA_SMALL_NUMBER);
+			const float NdcX = Clip.X * InvW;
+			const float NdcY = Clip.Y * InvW;
+
+			Screen[i] = FVector2D(NdcX * Half.X + Center.X, -NdcY * Half.Y + Center.Y);
+			Depth[i] = Clip.W;
+			Flags[i] = (uint8)((Clip.W > KINDA_SMALL_NUMBER ? InFront : 0)
+				| (FMath::Abs(NdcX) <= Limit && FMath::Abs(NdcY) <= Limit ? InView : 0)
+				| (FVector::DistSquared(P, View.ViewOrigin) <= MaxDistanceSq ? InRange : 0));
+		}
+	}, NumTasks == 1);
+}
+
+int32 FImGuiWorldOverlay::DrawPoints(ImDrawList* DrawList, const FImGuiOverlayView& View, const FVector* Positions, int32 Count,
+	const FString* Labels, int32 NumLabels, const ImU32* Colors, int32 NumColors, float MaxDistance, float PointRadius, bool bDeclutter)
+{
+	if (DrawList == nullptr || Count <= 0)
+		return 0;
+
+	TArray<FVector2D> Screen;
+	TArray<float> Depth;
+	TArray<uint8> Flags;
+	Project(View, Positions, Count, MaxDistance, 0.0f, Screen, Depth, Flags);
+
+	TArray<FVector2D> Centers;
+	TArray<ImU32> PointColors;
+	TArray<FLabelCandidate> Candidates;
+	for (int32 i = 0; i < Count; ++i)
+	{
+		if ((Flags[i] & Visible) != Visible)
+			continue;
+
+		Centers.Add(Screen[i]);
+		PointColors.Add(GetColor(Colors, NumColors, i));
+		if (i < NumLabels)
+		{
+			Candidates.Add({ i, Screen[i] - FVector2D(0.0f, PointRadius + 1.0f), Depth[i] });
+		}
+	}
+
+	if (PointRadius > 0.0f)
+	{
+		FImGuiDrawListBatch::AddCircles(DrawList, Centers.GetData(), Centers.Num(), &PointRadius, 1, PointColors.GetData(), PointColors.Num(), 1.0f, true);
+	}
+	DrawLabels(DrawList, View, Candidates, Labels, Colors, NumColors, bDeclutter);
+	return Centers.Num();
+}
+
+int32 FImGuiWorldOverlay::DrawBoxes(ImDrawList* DrawList, const FImGuiOverlayView& View, const FBox* Boxes, int32 Count,
+	const FString* Labels, int32 NumLabels, const ImU32* Colors, int32 NumColors, float MaxDistance, float Thickness, bool bDeclutter)
+{
+	if (DrawList == nullptr || Count <= 0)
+		return 0;
+
+	// 8 corners (bit 0: X, bit 1: Y, bit 2: Z of the max corner) and the center of every box, projected in one pass
+	constexpr int32 PointsPerBox = 9;
+	TArray<FVector> Points;
+	Points.SetNumUninitialized(Count * PointsPerBox);
+	for (int32 i = 0; i < Count; ++i)
+	{
+		const FBox& Box = Boxes[i];
+		FVector* Out = Points.GetData() + i * PointsPerBox;
+		for (int32 k = 0; k < 8; ++k)
+		{
+			Out[k] = FVector(k & 1 ? Box.Max.X : Box.Min.X, k & 2 ? Box.Max.Y : Box.Min.Y, k & 4 ? Box.Max.Z : Box.Min.Z);
+		}
+		Out[8] = Box.GetCenter();
+	}
+
+	TArray<FVector2D> Screen;
+	TArray<float> Depth;
+	TArray<uint8> Flags;
+	Project(View, Points.GetData(), Points.Num(), MaxDistance, 0.0f, Screen, Depth, Flags);
+
+	const FBox2D ScreenRect(View.ScreenMin, View.ScreenMin + View.ScreenSize);
+	TArray<FVector2D> LinePoints;
+	TArray<ImU32> LineColors;
+	TArray<FLabelCandidate> Candidates;
+	int32 NumDrawn = 0;
+	for (int32 i = 0; i < Count; ++i)
+	{
+		const int32 First = i * PointsPerBox;
+		if (!(Flags[First + 8] & InRange))
+			continue;
+
+		// boxes crossing the camera plane are skipped rather than clipped
+		FBox2D Rect(ForceInit);
+		bool bInFront = true;
+		for (int32 k = 0; k < 8 && bInFront; ++k)
+		{
+			bInFront = (Flags[First + k] & InFront) != 0;
+			Rect += Screen[First + k];
+		}
+		if (!bInFront || !Rect.Intersect(ScreenRect))
+			continue;
+
+		const ImU32 Color = GetColor(Colors, NumColors, i);
+		for (int32 k = 0; k < 8; ++k)
+		{
+			for (const int32 Axis : { 1, 2, 4 })
+			{
+				if (!(k & Axis))
+				{
+					LinePoints.Add(Screen[First + k]);
+					LinePoints.Add(Screen[First + (k | Axis)]);
+					LineColors.Add(Color);
+				}
+			}
+		}
+		if (i < NumLabels)
+		{
+			Candidates.Add({ i, FVector2D((Rect.Min.X + Rect.Max.X) * 0.5f, Rect.Min.Y - 1.0f), Depth[First + 8] });
+		}
+		++NumDrawn;
+	}
+
+	FImGuiDrawListBatch::AddLines(DrawList, LinePoints.GetData(), LineColors.Num(), LineColors.GetData(), LineColors.Num(), Thickness);
+	DrawLabels(DrawList, View, Candidates, Labels, Colors, NumColors, bDeclutter);
+	return NumDrawn;
+}
+
+int32 UImGuiWorldOverlayFunction::DrawWorldPoints(const UObject* WorldContextObject, const TArray<FVector>& positions, const TArray<FString>& labels, const TArray<FLinearColor>& colors,
+	float max_distance, float point_radius, bool declutter_labels, int32 player_index, EImGuiDrawList target)
+{
+	FImGuiOverlayView View;
+	if (!FImGuiOverlayView::FromPlayer(UGameplayStatics::GetPlayerController(WorldContextObject, player_index), View))
+		return 0;
+
+	const TArray<ImU32, TInlineAllocator<64>> Colors = FImGuiDrawListBatch::ToColorsU32(colors);
+	return FImGuiWorldOverlay::DrawPoints(FImGuiDrawListBatch::GetDrawList(target), View, positions.GetData(), positions.Num(),
+		labels.GetData(), labels.Num(), Colors.GetData(), Colors.Num(), max_distance, point_radius, declutter_labels);
+}
+
+int32 UImGuiWorldOverlayFunction::DrawWorldBoxes(const UObject* WorldContextObject, const TArray<FBox>& boxes, const TArray<FString>& labels, const TArray<FLinearColor>& colors,
+	float max_distance, float thickness, bool declutter_labels, int32 player_index, EImGuiDrawList target)
+{
+	FImGuiOverlayView View;
+	if (!FImGuiOverlayView::FromPlayer(UGameplayStatics::GetPlayerController(WorldContextObject, player_index), View))
+		return 0;
+
+	const TArray<ImU32, TInlineAllocator<64>> Colors = FImGuiDrawListBatch::ToColorsU32(colors);
+	return FImGuiWorldOverlay::DrawBoxes(FImGuiDrawListBatch::GetDrawList(target), View, boxes.GetData(), boxes.Num(),
+		labels.GetData(), labels.Num(), Colors.GetData(), Colors.Num(), max_distance, thickness, declutter_labels);
+}
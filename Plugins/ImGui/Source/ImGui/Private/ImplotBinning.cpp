@@ -0,0 +1,324 @@
+// Distributed under the MIT License (MIT) (see accompanying LICENSE file)
+
+
+#include "ImplotBinning.h"
+
+#include "Async/ParallelFor.h"
+#include "ImplotCache.h"
+
+namespace
+{
+	FORCEINLINE VectorRegister LoadFloat4(const float* Ptr)
+	{
+		return VectorLoad(Ptr);
+	}
+
+	FORCEINLINE VectorRegister LoadFloat4(const int32* Ptr)
+	{
+		return VectorIntToFloat(VectorIntLoad(Ptr));
+	}
+
+	struct FAxisStats
+	{
+		double Min = TNumericLimits<double>::Max();
+		double Max = TNumericLimits<double>::Lowest();
+		double Sum = 0.0;
+		double SumSq = 0.0;
+
+		void Merge(const FAxisStats& Other)
+		{
+			Min = FMath::Min(Min, Other.Min);
+			Max = FMath::Max(Max, Other.Max);
+			Sum += Other.Sum;
+			SumSq += Other.SumSq;
+		}
+
+		double StdDev(int32 Count) const
+		{
+			if (Count <= 1)
+				return 0.0;
+			const double Mean = Sum / Count;
+			return FMath::Sqrt(FMath::Max(0.0, SumSq / Count - Mean * Mean));
+		}
+	};
+
+	// Min/max/sum/sum of squares of one axis, four lanes at a time.
+	template<typename T>
+	FAxisStats ComputeAxisStats(const T* Values, int32 Count)
+	{
+		const int32 NumTasks = ImPlotCache::GetNumTasks(Count, FImPlotBinning::MinPointsPerTask);
+		TArray<FAxisStats> Partial;
+		Partial.SetNum(NumTasks);
+
+		ParallelFor(NumTasks, [&](int32 Task)
+		{
+			const int32 Begin = (int64)Count * Task / NumTasks;
+			const int32 End = (int64)Count * (Task + 1) / NumTasks;
+
+			VectorRegister VMin = VectorSetFloat1(TNumericLimits<float>::Max());
+			VectorRegister VMax = VectorSetFloat1(TNumericLimits<float>::Lowest());
+			VectorRegister VSum = VectorZero();
+			VectorRegister VSumSq = VectorZero();
+
+			int32 i = Begin;
+			for (; i + 4 <= End; i += 4)
+			{
+				const VectorRegister V = LoadFloat4(Values + i);
+				VMin = VectorMin(VMin, V);
+				VMax = VectorMax(VMax, V);
+				VSum = VectorAdd(VSum, V);
+				VSumSq = VectorMultiplyAdd(V, V, VSumSq);
+			}
+
+			float Lanes[4][4];
+			VectorStore(VMin, Lanes[0]);
+			VectorStore(VMax, Lanes[1]);
+			VectorStore(VSum, Lanes[2]);
+			VectorStore(VSumSq, Lanes[3]);
+
+			FAxisStats& Stats = Partial[Task];
+			for (int32 Lane = 0; Lane < 4; ++Lane)
+			{
+				Stats.Min = FMath::Min<double>(Stats.Min, Lanes[0][Lane]);
+				Stats.Max = FMath::Max<double>(Stats.Max, Lanes[1][Lane]);
+				Stats.Sum += Lanes[2][Lane];
+				Stats.SumSq += Lanes[3][Lane];
+			}
+			for (; i < End; ++i)
+			{
+				const double V = Values[i];
+				Stats.Min = FMath::Min(Stats.Min, V);
+				Stats.Max = FMath::Max(Stats.Max, V);
+				Stats.Sum += V;
+				Stats.SumSq += V * V;
+			}
+		}, NumTasks == 1);
+
+		FAxisStats Result;
+		for (const FAxisStats& Stats : Partial)
+		{
+			Result.Merge(Stats);
+		}
+		return Result;
+	}
+
+	template<typename T>
+	bool BinHistogram2D(FImPlotBinnedGrid& Grid, const T* Xs, const T* Ys, int32 Count, int32 XBins, int32 YBins, bool bDensity, const ImPlotLimits& Range, bool bOutliers, int32 DataVersion)
+	{
+		Count = FMath::Max(0, Count);
+		const uint32 Fingerprint = HashCombine(ImPlotCache::SampleFingerprint(Xs, Count), ImPlotCache::SampleFingerprint(Ys, Count));
+
+		const bool bCacheValid = Grid.CachedCount == Count
+			&& Grid.CachedXs == Xs && Grid.CachedYs == Ys
+			&& Grid.CachedVersion == DataVersion
+			&& Grid.CachedFingerprint == Fingerprint
+			&& Grid.CachedXBins == XBins && Grid.CachedYBins == YBins
+			&& Grid.bCachedDensity == bDensity && Grid.bCachedOutliers == bOutliers
+			&& Grid.CachedRange.X.Min == Range.X.Min && Grid.CachedRange.X.Max == Range.X.Max
+			&& Grid.CachedRange.Y.Min == Range.Y.Min && Grid.CachedRange.Y.Max == Range.Y.Max;
+		if (bCacheValid)
+			return false;
+
+		Grid.CachedXs = Xs;
+		Grid.CachedYs = Ys;
+		Grid.CachedCount = Count;
+		Grid.CachedVersion = DataVersion;
+		Grid.CachedFingerprint = Fingerprint;
+		Grid.CachedXBins = XBins;
+		Grid.CachedYBins = YBins;
+		Grid.bCachedDensity = bDensity;
+		Grid.bCachedOutliers = bOutliers;
+		Grid.CachedRange = Range;
+		++Grid.Revision;
+
+		// resolve the range and bin counts the same way ImPlot::PlotHistogram2D does
+		const bool bAutoX = Range.X.Min == 0 && Range.X.Max == 0;
+		const bool bAutoY = Range.Y.Min == 0 && Range.Y.Max == 0;
+		const bool bNeedXStats = bAutoX || XBins < 0;
+		const bool bNeedYStats = bAutoY || YBins < 0;
+		const FAxisStats XStats = bNeedXStats ? ComputeAxisStats(Xs, Count) : FAxisStats();
+		const FAxisStats YStats = bNeedYStats ? ComputeAxisStats(Ys, Count) : FAxisStats();
+
+		ImPlotLimits Bounds = Range;
+		if (bAutoX && Count > 0) { Bounds.X.Min = XStats.Min; Bounds.X.Max = XStats.Max; }
+		if (bAutoY && Count > 0) { Bounds.Y.Min = YStats.Min; Bounds.Y.Max = YStats.Max; }
+
+		const int32 Cols = FImPlotBinning::ResolveBinCount(XBins, Count, Bounds.X.Size(), XStats.StdDev(Count));
+		const int32 Rows = FImPlotBinning::ResolveBinCount(YBins, Count, Bounds.Y.Size(), YStats.StdDev(Count));
+		const int32 NumCells = Rows * Cols;
+
+		Grid.Rows = Rows;
+		Grid.Cols = Cols;
+		Grid.Bounds = FImPlotLimits(Bounds);
+		Grid.Values.Reset(NumCells);
+		Grid.Values.AddZeroed(NumCells);
+		Grid.MaxValue = 0.0f;
+		Grid.BinnedCount = 0;
+
+		if (Count == 0 || NumCells == 0)
+			return true;
+
+		const double Width = Bounds.X.Size() / Cols;
+		const double Height = Bounds.Y.Size() / Rows;
+		const float XMin = static_cast<float>(Bounds.X.Min), XMax = static_cast<float>(Bounds.X.Max);
+		const float YMin = static_cast<float>(Bounds.Y.Min), YMax = static_cast<float>(Bounds.Y.Max);
+		const float XScale = Width > 0.0 ? static_cast<float>(1.0 / Width) : 0.0f;
+		const float YScale = Height > 0.0 ? static_cast<float>(1.0 / Height) : 0.0f;
+
+		// bin into per-task partial grids
+		const int32 NumTasks = ImPlotCache::GetNumTasks(Count, FImPlotBinning::MinPointsPerTask);
+		TArray<TArray<float>> Partial;
+		Partial.SetNum(NumTasks);
+
+		ParallelFor(NumTasks, [&](int32 Task)
+		{
+			const int32 Begin = (int64)Count * Task / NumTasks;
+			const int32 End = (int64)Count * (Task + 1) / NumTasks;
+
+			TArray<float>& Local = Partial[Task];
+			Local.AddZeroed(NumCells);
+			float* Cells = Local.GetData();
+
+			const VectorRegister VXMin = VectorSetFloat1(XMin);
+			const VectorRegister VXMax = VectorSetFloat1(XMax);
+			const VectorRegister VYMin = VectorSetFloat1(YMin);
+			const VectorRegister VYMax = VectorSetFloat1(YMax);
+			const VectorRegister VXScale = VectorSetFloat1(XScale);
+			const VectorRegister VYScale = VectorSetFloat1(YScale);
+			const VectorRegister VXLast = VectorSetFloat1(Cols - 1);
+			const VectorRegister VYLast = VectorSetFloat1(Rows - 1);
+
+			int32 i = Begin;
+			alignas(16) int32 XB[4];
+			alignas(16) int32 YB[4];
+			for (; i + 4 <= End; i += 4)
+			{
+				const VectorRegister X = LoadFloat4(Xs + i);
+				const VectorRegister Y = LoadFloat4(Ys + i);
+
+				const VectorRegister InX = VectorBitwiseAnd(VectorCompareGE(X, VXMin), VectorCompareLE(X, VXMax));
+				const VectorRegister InY = VectorBitwiseAnd(VectorCompareGE(Y, VYMin), VectorCompareLE(Y, VYMax));
+				const int32 Mask = VectorMaskBits(VectorBitwiseAnd(InX, InY));
+				if (Mask == 0)
+					continue;
+
+				const VectorRegister FX = VectorMin(VectorMax(VectorMultiply(VectorSubtract(X, VXMin), VXScale), VectorZero()), VXLast);
+				const VectorRegister FY = VectorMin(VectorMax(VectorMultiply(VectorSubtract(Y, VYMin), VYScale), VectorZero()), VYLast);
+				VectorIntStore(VectorFloatToInt(FX), XB);
+				VectorIntStore(VectorFloatToInt(FY), YB);
+
+				for (int32 Lane = 0; Lane < 4; ++Lane)
+				{
+					if (Mask & (1 << Lane))
+					{
+						Cells[(Rows - 1 - YB[Lane]) * Cols + XB[Lane]] += 1.0f;
+					}
+				}
+			}
+			for (; i < End; ++i)
+			{
+				const float X = Xs[i];
+				const float Y = Ys[i];
+				if (X >= XMin && X <= XMax && Y >= YMin && Y <= YMax)
+				{
+					const int32 XIndex = FMath::Clamp((int32)((X - XMin) * XScale), 0, Cols - 1);
+					const int32 YIndex = FMath::Clamp((int32)((Y - YMin) * YScale), 0, Rows - 1);
+					Cells[(Rows - 1 - YIndex) * Cols + XIndex] += 1.0f;
+				}
+			}
+		}, NumTasks == 1);
+
+		// SIMD reduction of the partial grids, split in cell blocks
+		constexpr int32 CellsPerBlock = 4096;
+		const int32 NumBlocks = FMath::DivideAndRoundUp(NumCells, CellsPerBlock);
+		float* Out = Grid.Values.GetData();
+
+		ParallelFor(NumBlocks, [&](int32 Block)
+		{
+			const int32 Begin = Block * CellsPerBlock;
+			const int32 End = FMath::Min(Begin + CellsPerBlock, NumCells);
+
+			int32 c = Begin;
+			for (; c + 4 <= End; c += 4)
+			{
+				VectorRegister Sum = VectorZero();
+				for (const TArray<float>& Local : Partial)
+				{
+					Sum = VectorAdd(Sum, VectorLoad(Local.GetData() + c));
+				}
+				VectorStore(Sum, Out + c);
+			}
+			for (; c < End; ++c)
+			{
+				float Sum = 0.0f;
+				for (const TArray<float>& Local : Partial)
+				{
+					Sum += Local[c];
+				}
+				Out[c] = Sum;
+			}
+		}, NumBlocks == 1);
+
+		float MaxCount = 0.0f;
+		double Binned = 0.0;
+		for (int32 c = 0; c < NumCells; ++c)
+		{
+			MaxCount = FMath::Max(MaxCount, Out[c]);
+			Binned += Out[c];
+		}
+		Grid.BinnedCount = (int32)Binned;
+
+		if (bDensity)
+		{
+			const double Normalizer = (bOutliers ? Count : Grid.BinnedCount) * Width * Height;
+			const float Scale = Normalizer > 0.0 ? static_cast<float>(1.0 / Normalizer) : 0.0f;
+			const VectorRegister VScale = VectorSetFloat1(Scale);
+			int32 c = 0;
+			for (; c + 4 <= NumCells; c += 4)
+			{
+				VectorStore(VectorMultiply(VectorLoad(Out + c), VScale), Out + c);
+			}
+			for (; c < NumCells; ++c)
+			{
+				Out[c] *= Scale;
+			}
+			MaxCount *= Scale;
+		}
+
+		Grid.MaxValue = MaxCount;
+		return true;
+	}
+}
+
+int32 FImPlotBinning::ResolveBinCount(int32 Bins, int32 Count, double Size, double StdDev)
+{
+	if (Bins > 0)
+		return Bins;
+
+	const float N = static_cast<float>(FMath::Max(1, Count));
+	switch (Bins)
+	{
+	case EImPlotBin::ImPlotBin_Sqrt:
+		return FMath::Max(1, FMath::CeilToInt(FMath::Sqrt(N)));
+	case EImPlotBin::ImPlotBin_Rice:
+		return FMath::Max(1, FMath::CeilToInt(2.0f * FMath::Pow(N, 1.0f / 3.0f)));
+	case EImPlotBin::ImPlotBin_Scott:
+	{
+		const double Width = 3.49 * StdDev / FMath::Pow(N, 1.0f / 3.0f);
+		return Width > 0.0 ? FMath::Max(1, (int32)FMath::RoundToDouble(Size / Width)) : 1;
+	}
+	case EImPlotBin::ImPlotBin_Sturges:
+	default:
+		return FMath::Max(1, FMath::CeilToInt(1.0f + FMath::Log2(N)));
+	}
+}
+
+bool FImPlotBinning::Histogram2D(FImPlotBinnedGrid& Grid, const float* Xs, const float* Ys, int32 Count, int32 XBins, int32 YBins, bool bDensity, const ImPlotLimits& Range, bool bOutliers, int32 DataVersion)
+{
+	return BinHistogram2D(Grid, Xs, Ys, Count, XBins, YBins, bDensity, Range, bOutliers, DataVersion);
+}
+
+bool FImPlotBinning::Histogram2D(FImPlotBinnedGrid& Grid, const int32* Xs, const int32* Ys, int32 Count, int32 XBins, int32 YBins, bool bDensity, const ImPlotLimits& Range, bool bOutliers, int32 DataVersion)
+{
+	return BinHistogram2D(Grid, Xs, Ys, Count, XBins, YBins, bDensity, Range, bOutliers, DataVersion);
+}
@@ -0,0 +1,134 @@
+// Distributed under the MIT License (MIT) (see accompanying LICENSE file)
+
+
+#include "ImplotColormapLut.h"
+
+#include "Async/ParallelFor.h"
+#include "ImplotCache.h"
+
+namespace
+{
+	struct FTableStorage
+	{
+		TMap<uint64, TUniquePtr<FImPlotColormapTable>> Tables;
+		const ImPlotContext* Context = nullptr;
+	};
+
+	FTableStorage& GetStorage()
+	{
+		static FTableStorage Storage;
+		return Storage;
+	}
+
+	int32 ResolveColormap(int32 Colormap)
+	{
+		return Colormap < 0 ? ImPlot::GetStyle().Colormap : Colormap;
+	}
+
+	FORCEINLINE const TArray<FColor>& GetColors(const FImPlotColormapTable& Table, const FColor*) { return Table.Colors; }
+	FORCEINLINE const TArray<FLinearColor>& GetColors(const FImPlotColormapTable& Table, const FLinearColor*) { return Table.LinearColors; }
+	FORCEINLINE const TArray<ImU32>& GetColors(const FImPlotColormapTable& Table, const ImU32*) { return Table.PackedColors; }
+
+	template<typename TColor>
+	void SampleBatch(const float* Values, int32 Count, float ScaleMin, float ScaleMax, TColor* Out, int32 Colormap, int32 Size)
+	{
+		if (Values == nullptr || Out == nullptr || Count <= 0)
+			return;
+
+		const FImPlotColormapTable& Table = FImPlotColormapLut::Get(Colormap, Size);
+		const TColor* Colors = GetColors(Table, Out).GetData();
+		const int32 Last = Table.Num() - 1;
+		const float Range = ScaleMax - ScaleMin;
+		const float Scale = Range != 0.0f ? Last / Range : 0.0f;
+
+		const int32 NumTasks = ImPlotCache::GetNumTasks(Count, FImPlotColormapLut::MinValuesPerTask);
+		ParallelFor(NumTasks, [&](int32 Task)
+		{
+			const int32 Begin = (int64)Count * Task / NumTasks;
+			const int32 End = (int64)Count * (Task + 1) / NumTasks;
+
+			const VectorRegister VMin = VectorSetFloat1(ScaleMin);
+			const VectorRegister VScale = VectorSetFloat1(Scale);
+			const VectorRegister VHalf = VectorSetFloat1(0.5f);
+			const VectorRegister VLast = VectorSetFloat1((float)Last);
+			alignas(16) int32 Index[4];
+
+			int32 i = Begin;
+			for (; i + 4 <= End; i += 4)
+			{
+				// max(NaN, 0) yields 0, so NaN lands on the first entry
+				const VectorRegister T = VectorMultiplyAdd(VectorSubtract(VectorLoad(Values + i), VMin), VScale, VHalf);
+				VectorIntStore(VectorFloatToInt(VectorMin(VectorMax(T, VectorZero()), VLast)), Index);
+				Out[i + 0] = Colors[Index[0]];
+				Out[i + 1] = Colors[Index[1]];
+				Out[i + 2] = Colors[Index[2]];
+				Out[i + 3] = Colors[Index[3]];
+			}
+			for (; i < End; ++i)
+			{
+				const float T = (Values[i] - ScaleMin) * Scale + 0.5f;
+				Out[i] = Colors[T == T ? FMath::Clamp((int32)T, 0, Last) : 0];
+			}
+		}, NumTasks == 1);
+	}
+}
+
+const FImPlotColormapTable& FImPlotColormapLut::Get(int32 Colormap, int32 Size)
+{
+	FTableStorage& Storage = GetStorage();
+	const ImPlotContext* Context = ImPlot::GetCurrentContext();
+	if (Storage.Context != Context)
+	{
+		// colormap indices are only stable within one context
+		Storage.Tables.Reset();
+		Storage.Context = Context;
+	}
+
+	Colormap = ResolveColormap(Colormap);
+	Size = FMath::Max(2, Size);
+	const uint64 Key = ((uint64)(uint32)Colormap << 32) | (uint32)Size;
+
+	if (const TUniquePtr<FImPlotColormapTable>* Found = Storage.Tables.Find(Key))
+		return **Found;
+
+	TUniquePtr<FImPlotColormapTable> Table = MakeUnique<FImPlotColormapTable>();
+	Table->Colors.SetNumUninitialized(Size);
+	Table->LinearColors.SetNumUninitialized(Size);
+	Table->PackedColors.SetNumUninitialized(Size);
+	for (int32 i = 0; i < Size; ++i)
+	{
+		const ImVec4 Color = ImPlot::SampleColormap((float)i / (Size - 1), Colormap);
+		Table->LinearColors[i] = FLinearColor(Color.x, Color.y, Color.z, Color.w);
+		Table->Colors[i] = Table->LinearColors[i].ToFColor(false);
+		Table->PackedColors[i] = ImGui::ColorConvertFloat4ToU32(Color);
+	}
+
+	return *Storage.Tables.Add(Key, MoveTemp(Table));
+}
+
+void FImPlotColormapLut::Prepare(int32 Colormap)
+{
+	Colormap = ResolveColormap(Colormap);
+	Get(Colormap, DefaultSize);
+	Get(Colormap, HighResSize);
+}
+
+void FImPlotColormapLut::Sample(const float* Values, int32 Count, float ScaleMin, float ScaleMax, FColor* Out, int32 Colormap, int32 Size)
+{
+	SampleBatch(Values, Count, ScaleMin, ScaleMax, Out, Colormap, Size);
+}
+
+void FImPlotColormapLut::Sample(const float* Values, int32 Count, float ScaleMin, float ScaleMax, FLinearColor* Out, int32 Colormap, int32 Size)
+{
+	SampleBatch(Values, Count, ScaleMin, ScaleMax, Out, Colormap, Size);
+}
+
+void FImPlotColormapLut::Sample(const float* Values, int32 Count, float ScaleMin, float ScaleMax, ImU32* Out, int32 Colormap, int32 Size)
+{
+	SampleBatch(Values, Count, ScaleMin, ScaleMax, Out, Colormap, Size);
+}
+
+void FImPlotColormapLut::Reset()
+{
+	GetStorage().Tables.Reset();
+}
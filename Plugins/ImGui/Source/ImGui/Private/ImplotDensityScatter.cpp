@@ -0,0 +1,235 @@
+// Distributed under the MIT License (MIT) (see accompanying LICENSE file)
+
+
+#include "ImplotDensityScatter.h"
+
+#include "Async/ParallelFor.h"
+#include "ImplotCache.h"
+#include "ImplotColormapLut.h"
+
+#include <implot_internal.h>
+
+namespace
+{
+	FORCEINLINE float ReadStrided(const float* Base, int32 Index, int32 Stride)
+	{
+		return *reinterpret_cast<const float*>(reinterpret_cast<const uint8*>(Base) + (int64)Index * Stride);
+	}
+
+	uint32 SampleFingerprint(const float* Xs, const float* Ys, int32 Count, int32 Stride)
+	{
+		constexpr int32 NumSamples = 64;
+		uint32 Hash = GetTypeHash(Count);
+		if (Count <= 0)
+			return Hash;
+
+		const int32 Step = FMath::Max(1, Count / NumSamples);
+		for (int32 i = 0; i < Count; i += Step)
+		{
+			Hash = HashCombine(Hash, HashCombine(GetTypeHash(ReadStrided(Xs, i, Stride)), GetTypeHash(ReadStrided(Ys, i, Stride))));
+		}
+		return HashCombine(Hash, HashCombine(GetTypeHash(ReadStrided(Xs, Count - 1, Stride)), GetTypeHash(ReadStrided(Ys, Count - 1, Stride))));
+	}
+
+	bool SameLimits(const ImPlotLimits& A, const ImPlotLimits& B)
+	{
+		return A.X.Min == B.X.Min && A.X.Max == B.X.Max && A.Y.Min == B.Y.Min && A.Y.Max == B.Y.Max;
+	}
+
+	// Plot space to texel space along one axis. A log axis is linear in log10, so values and limits are
+	// moved there first; a non-positive value becomes NaN or -inf and falls outside.
+	struct FAxisTransform
+	{
+		float Min = 0.0f;
+		float Scale = 0.0f;
+		bool bLog = false;
+
+		bool Init(const ImPlotRange& Range, int32 Texels, bool bLogAxis)
+		{
+			bLog = bLogAxis;
+			if (bLog && Range.Min <= 0.0)
+				return false;
+
+			const double RangeMin = bLog ? FMath::LogX(10.0, Range.Min) : Range.Min;
+			const double RangeMax = bLog ? FMath::LogX(10.0, Range.Max) : Range.Max;
+			if (RangeMax - RangeMin <= 0.0)
+				return false;
+
+			Min = static_cast<float>(RangeMin);
+			Scale = static_cast<float>(Texels / (RangeMax - RangeMin));
+			return true;
+		}
+
+		FORCEINLINE float operator()(float Value) const
+		{
+			return ((bLog ? log10f(Value) : Value) - Min) * Scale;
+		}
+	};
+
+	// Counts the points per texel into Density.Counts (Width x Height, row 0 at the top).
+	void Splat(FImPlotScatterDensity& Density, const float* Xs, const float* Ys, int32 Count, int32 Stride, const ImPlotLimits& Limits,
+		bool bLogX, bool bLogY, int32 Width, int32 Height)
+	{
+		const int32 NumTexels = Width * Height;
+		Density.Counts.Reset(NumTexels);
+		Density.Counts.AddZeroed(NumTexels);
+
+		FAxisTransform ToX, ToY;
+		if (Count <= 0 || !ToX.Init(Limits.X, Width, bLogX) || !ToY.Init(Limits.Y, Height, bLogY))
+			return;
+
+		const float FWidth = static_cast<float>(Width);
+		const float FHeight = static_cast<float>(Height);
+
+		// every task counts into its own buffer (the first one directly into the result)
+		const int32 NumTasks = ImPlotCache::GetNumTasks(Count, FImPlotDensityScatter::MinPointsPerTask);
+		TArray<TArray<uint32>> Partial;
+		Partial.SetNum(NumTasks - 1);
+
+		ParallelFor(NumTasks, [&](int32 Task)
+		{
+			uint32* Texels;
+			if (Task == 0)
+			{
+				Texels = Density.Counts.GetData();
+			}
+			else
+			{
+				Partial[Task - 1].AddZeroed(NumTexels);
+				Texels = Partial[Task - 1].GetData();
+			}
+
+			const int32 Begin = (int64)Count * Task / NumTasks;
+			const int32 End = (int64)Count * (Task + 1) / NumTasks;
+			for (int32 i = Begin; i < End; ++i)
+			{
+				const float PX = ToX(ReadStrided(Xs, i, Stride));
+				const float PY = FHeight - ToY(ReadStrided(Ys, i, Stride));
+				// also rejects NaN
+				if (PX >= 0.0f && PX < FWidth && PY >= 0.0f && PY < FHeight)
+				{
+					++Texels[(int32)PY * Width + (int32)PX];
+				}
+			}
+		}, NumTasks == 1);
+
+		if (Partial.Num() == 0)
+			return;
+
+		constexpr int32 TexelsPerBlock = 4096;
+		const int32 NumBlocks = FMath::DivideAndRoundUp(NumTexels, TexelsPerBlock);
+		uint32* Out = Density.Counts.GetData();
+		ParallelFor(NumBlocks, [&](int32 Block)
+		{
+			const int32 Begin = Block * TexelsPerBlock;
+			const int32 End = FMath::Min(Begin + TexelsPerBlock, NumTexels);
+			for (const TArray<uint32>& Local : Partial)
+			{
+				const uint32* In = Local.GetData();
+				for (int32 t = Begin; t < End; ++t)
+				{
+					Out[t] += In[t];
+				}
+			}
+		}, NumBlocks == 1);
+	}
+
+	void Colorize(FImPlotScatterDensity& Density, int32 Colormap, bool bLogScale)
+	{
+		const int32 NumTexels = Density.Counts.Num();
+		const uint32* Counts = Density.Counts.GetData();
+
+		uint32 MaxCount = 0;
+		uint64 Total = 0;
+		for (int32 t = 0; t < NumTexels; ++t)
+		{
+			MaxCount = FMath::Max(MaxCount, Counts[t]);
+			Total += Counts[t];
+		}
+		Density.MaxCount = (int32)MaxCount;
+		Density.VisibleCount = (int32)Total;
+
+		const FImPlotColormapTable& Table = FImPlotColormapLut::Get(Colormap);
+		const FColor* Lut = Table.Colors.GetData();
+		const int32 LutLast = Table.Num() - 1;
+
+		// a single point maps to the bottom of the colormap, the densest pixel to the top
+		const float Max = bLogScale ? FMath::Loge(1.0f + MaxCount) : (float)MaxCount;
+		const float Scale = Max > 0.0f ? LutLast / Max : 0.0f;
+
+		Density.Image.Pixels.SetNumUninitialized(NumTexels);
+		FColor* Pixels = Density.Image.Pixels.GetData();
+
+		const int32 NumTasks = ImPlotCache::GetNumTasks(NumTexels, FImPlotHeatmapRasterizer::MinTexelsPerTask);
+		ParallelFor(NumTasks, [&](int32 Task)
+		{
+			const int32 Begin = (int64)NumTexels * Task / NumTasks;
+			const int32 End = (int64)NumTexels * (Task + 1) / NumTasks;
+			for (int32 t = Begin; t < End; ++t)
+			{
+				const uint32 C = Counts[t];
+				if (C == 0)
+				{
+					Pixels[t] = FColor(0, 0, 0, 0);
+					continue;
+				}
+				const float V = bLogScale ? FMath::Loge(1.0f + C) : (float)C;
+				Pixels[t] = Lut[FMath::Clamp(FMath::RoundToInt(V * Scale), 0, LutLast)];
+			}
+		}, NumTasks == 1);
+	}
+}
+
+void FImPlotDensityScatter::Plot(const char* LabelId, FImPlotScatterDensity& Density, const float* Xs, const float* Ys, int32 Count, int32 Stride,
+	int32 Colormap, bool bLogScale, int32 PixelSize, int32 DataVersion)
+{
+	Count = (Xs != nullptr && Ys != nullptr) ? FMath::Max(0, Count) : 0;
+	if (Colormap < 0)
+		Colormap = ImPlot::GetStyle().Colormap;
+
+	const ImPlotLimits Limits = ImPlot::GetPlotLimits();
+	const ImPlotPlot& CurrentPlot = *ImPlot::GetCurrentPlot();
+	const bool bLogX = (CurrentPlot.XAxis.Flags & ImPlotAxisFlags_LogScale) != 0;
+	const bool bLogY = (CurrentPlot.YAxis[CurrentPlot.CurrentYAxis].Flags & ImPlotAxisFlags_LogScale) != 0;
+	const ImVec2 PlotSize = ImPlot::GetPlotSize();
+	PixelSize = FMath::Max(1, PixelSize);
+	const int32 Width = FMath::Max(1, (int32)PlotSize.x / PixelSize);
+	const int32 Height = FMath::Max(1, (int32)PlotSize.y / PixelSize);
+	const uint32 Fingerprint = SampleFingerprint(Xs, Ys, Count, Stride);
+
+	FImPlotHeatmapImage& Image = Density.Image;
+	const bool bCacheValid = Image.Texture != nullptr
+		&& Image.Width == Width && Image.Height == Height
+		&& Density.CachedXs == Xs && Density.CachedYs == Ys
+		&& Density.CachedCount == Count && Density.CachedStride == Stride
+		&& Density.CachedVersion == DataVersion
+		&& Density.CachedFingerprint == Fingerprint
+		&& SameLimits(Density.CachedLimits, Limits)
+		&& Density.bCachedLogX == bLogX && Density.bCachedLogY == bLogY
+		&& Density.CachedColormap == Colormap
+		&& Density.bCachedLogScale == bLogScale;
+
+	if (!bCacheValid)
+	{
+		Density.CachedXs = Xs;
+		Density.CachedYs = Ys;
+		Density.CachedCount = Count;
+		Density.CachedStride = Stride;
+		Density.CachedVersion = DataVersion;
+		Density.CachedFingerprint = Fingerprint;
+		Density.CachedLimits = Limits;
+		Density.bCachedLogX = bLogX;
+		Density.bCachedLogY = bLogY;
+		Density.CachedColormap = Colormap;
+		Density.bCachedLogScale = bLogScale;
+
+		Splat(Density, Xs, Ys, Count, Stride, Limits, bLogX, bLogY, Width, Height);
+		Colorize(Density, Colormap, bLogScale);
+
+		Image.Width = Width;
+		Image.Height = Height;
+		FImPlotHeatmapRasterizer::Upload(Image);
+	}
+
+	FImPlotHeatmapRasterizer::Plot(LabelId, Image, ImPlotPoint(Limits.X.Min, Limits.Y.Min), ImPlotPoint(Limits.X.Max, Limits.Y.Max));
+}
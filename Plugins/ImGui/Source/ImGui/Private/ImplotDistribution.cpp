@@ -0,0 +1,122 @@
+// Distributed under the MIT License (MIT) (see accompanying LICENSE file)
+
+
+#include "ImplotDistribution.h"
+
+#include "Async/ParallelFor.h"
+
+namespace
+{
+	// uniform in (0, 1], safe to feed into a log
+	FORCEINLINE float OpenUniform(FRandomStream& Stream)
+	{
+		return 1.0f - Stream.GetFraction();
+	}
+
+	// Box-Muller on four pairs at once: writes 8 standard normal samples.
+	FORCEINLINE void BoxMuller4(const float* U1, const float* U2, float* Out)
+	{
+		const VectorRegister MinusTwo = VectorSetFloat1(-2.0f);
+		const VectorRegister TwoPi = VectorSetFloat1(2.0f * PI);
+
+		const VectorRegister R2 = VectorMultiply(MinusTwo, VectorLog(VectorLoad(U1)));
+		// sqrt(r2) = r2 * rsqrt(r2), with r2 clamped away from 0 so u1 == 1 yields 0 instead of NaN
+		const VectorRegister R = VectorMultiply(R2, VectorReciprocalSqrtAccurate(VectorMax(R2, VectorSetFloat1(SMALL_NUMBER))));
+		const VectorRegister Theta = VectorMultiply(TwoPi, VectorLoad(U2));
+
+		VectorRegister Sin, Cos;
+		VectorSinCos(&Sin, &Cos, &Theta);
+		VectorStore(VectorMultiply(R, Cos), Out);
+		VectorStore(VectorMultiply(R, Sin), Out + 4);
+	}
+
+	void GenerateChunk(float* Out, int32 Count, EImPlotDistribution Type, uint32 ChunkSeed, float A, float B)
+	{
+		FRandomStream Stream((int32)ChunkSeed);
+
+		if (Type == EImPlotDistribution::Uniform)
+		{
+			const float Range = B - A;
+			for (int32 i = 0; i < Count; ++i)
+			{
+				Out[i] = A + Range * Stream.GetFraction();
+			}
+			return;
+		}
+
+		if (Type == EImPlotDistribution::Exponential)
+		{
+			const VectorRegister Scale = VectorSetFloat1(A > 0.0f ? -1.0f / A : 0.0f);
+			alignas(16) float U[4];
+			int32 i = 0;
+			for (; i + 4 <= Count; i += 4)
+			{
+				for (int32 Lane = 0; Lane < 4; ++Lane)
+				{
+					U[Lane] = OpenUniform(Stream);
+				}
+				VectorStore(VectorMultiply(Scale, VectorLog(VectorLoad(U))), Out + i);
+			}
+			for (; i < Count; ++i)
+			{
+				Out[i] = A > 0.0f ? -FMath::Loge(OpenUniform(Stream)) / A : 0.0f;
+			}
+			return;
+		}
+
+		// Normal and LogNormal: batched Box-Muller, 8 samples per iteration
+		const VectorRegister Mean = VectorSetFloat1(A);
+		const VectorRegister StdDev = VectorSetFloat1(B);
+		alignas(16) float U1[4];
+		alignas(16) float U2[4];
+		alignas(16) float Z[8];
+
+		int32 i = 0;
+		while (i < Count)
+		{
+			for (int32 Lane = 0; Lane < 4; ++Lane)
+			{
+				U1[Lane] = OpenUniform(Stream);
+				U2[Lane] = Stream.GetFraction();
+			}
+			BoxMuller4(U1, U2, Z);
+
+			for (int32 Half = 0; Half < 2; ++Half)
+			{
+				VectorRegister V = VectorMultiplyAdd(VectorLoad(Z + Half * 4), StdDev, Mean);
+				if (Type == EImPlotDistribution::LogNormal)
+				{
+					V = VectorExp(V);
+				}
+				VectorStore(V, Z + Half * 4);
+			}
+
+			const int32 Num = FMath::Min(8, Count - i);
+			FMemory::Memcpy(Out + i, Z, Num * sizeof(float));
+			i += Num;
+		}
+	}
+}
+
+void FImPlotDistribution::Generate(TArray<float>& Out, EImPlotDistribution Type, int32 Count, int32 Seed, float A, float B)
+{
+	Count = FMath::Max(0, Count);
+	Out.Reset(Count);
+	Out.AddUninitialized(Count);
+	Generate(Out.GetData(), Type, Count, Seed, A, B);
+}
+
+void FImPlotDistribution::Generate(float* Out, EImPlotDistribution Type, int32 Count, int32 Seed, float A, float B)
+{
+	if (Count <= 0)
+		return;
+
+	const int32 NumChunks = FMath::DivideAndRoundUp(Count, ChunkSize);
+	ParallelFor(NumChunks, [=](int32 Chunk)
+	{
+		const int32 Begin = Chunk * ChunkSize;
+		const int32 Num = FMath::Min(ChunkSize, Count - Begin);
+		const uint32 ChunkSeed = HashCombine(GetTypeHash(Seed), GetTypeHash(Chunk));
+		GenerateChunk(Out + Begin, Num, Type, ChunkSeed, A, B);
+	}, NumChunks == 1);
+}
@@ -0,0 +1,218 @@
+// Distributed under the MIT License (MIT) (see accompanying LICENSE file)
+
+
+#include "ImplotHeatmapImage.h"
+
+#include "Async/ParallelFor.h"
+#include "RHI.h"
+#include "ImGuiTextureCache.h"
+#include "ImplotCache.h"
+#include "ImplotColormapLut.h"
+
+namespace
+{
+	// Number of cells averaged into one texel along an axis of #Num cells drawn over #MaxTexels.
+	int32 GetBlockSize(int32 Num, int32 MaxTexels)
+	{
+		if (MaxTexels <= 0 || Num <= MaxTexels)
+			return 1;
+		return (int32)FMath::RoundUpToPowerOfTwo(FMath::DivideAndRoundUp(Num, MaxTexels));
+	}
+
+	template<typename T>
+	void GetMinMax(const T* Values, int32 Count, float& OutMin, float& OutMax)
+	{
+		const int32 NumTasks = ImPlotCache::GetNumTasks(Count, FImPlotHeatmapRasterizer::MinTexelsPerTask);
+		TArray<FVector2D> Partial;
+		Partial.Init(FVector2D(TNumericLimits<float>::Max(), TNumericLimits<float>::Lowest()), NumTasks);
+
+		ParallelFor(NumTasks, [&](int32 Task)
+		{
+			const int32 Begin = (int64)Count * Task / NumTasks;
+			const int32 End = (int64)Count * (Task + 1) / NumTasks;
+			FVector2D& Range = Partial[Task];
+			for (int32 i = Begin; i < End; ++i)
+			{
+				const float V = static_cast<float>(Values[i]);
+				Range.X = FMath::Min(Range.X, V);
+				Range.Y = FMath::Max(Range.Y, V);
+			}
+		}, NumTasks == 1);
+
+		OutMin = TNumericLimits<float>::Max();
+		OutMax = TNumericLimits<float>::Lowest();
+		for (const FVector2D& Range : Partial)
+		{
+			OutMin = FMath::Min(OutMin, Range.X);
+			OutMax = FMath::Max(OutMax, Range.Y);
+		}
+	}
+
+	template<typename T>
+	bool RasterizeGrid(FImPlotHeatmapImage& Image, const T* Values, int32 Rows, int32 Cols, float ScaleMin, float ScaleMax, int32 Colormap, int32 MaxWidth, int32 MaxHeight, int32 DataVersion)
+	{
+		if (Values == nullptr || Rows <= 0 || Cols <= 0)
+			return false;
+
+		if (Colormap < 0)
+			Colormap = ImPlot::GetStyle().Colormap;
+
+		const int32 Count = Rows * Cols;
+		const int32 CellsX = GetBlockSize(Cols, MaxWidth);
+		const int32 CellsY = GetBlockSize(Rows, MaxHeight);
+		const uint32 Fingerprint = ImPlotCache::SampleFingerprint(Values, Count);
+
+		const bool bCacheValid = Image.Texture != nullptr
+			&& Image.CachedValues == Values
+			&& Image.CachedRows == Rows && Image.CachedCols == Cols
+			&& Image.CachedVersion == DataVersion
+			&& Image.CachedFingerprint == Fingerprint
+			&& Image.CachedScaleMin == ScaleMin && Image.CachedScaleMax == ScaleMax
+			&& Image.CachedColormap == Colormap
+			&& Image.CachedCellsX == CellsX && Image.CachedCellsY == CellsY;
+		if (bCacheValid)
+			return false;
+
+		Image.CachedValues = Values;
+		Image.CachedRows = Rows;
+		Image.CachedCols = Cols;
+		Image.CachedVersion = DataVersion;
+		Image.CachedFingerprint = Fingerprint;
+		Image.CachedScaleMin = ScaleMin;
+		Image.CachedScaleMax = ScaleMax;
+		Image.CachedColormap = Colormap;
+		Image.CachedCellsX = CellsX;
+		Image.CachedCellsY = CellsY;
+
+		// same rule as PlotHeatmap: a (0, 0) scale means the data min/max
+		if (ScaleMin == 0.0f && ScaleMax == 0.0f)
+		{
+			GetMinMax(Values, Count, ScaleMin, ScaleMax);
+		}
+		Image.Scale = FVector2D(ScaleMin, ScaleMax);
+
+		const int32 Width = FMath::DivideAndRoundUp(Cols, CellsX);
+		const int32 Height = FMath::DivideAndRoundUp(Rows, CellsY);
+		Image.Width = Width;
+		Image.Height = Height;
+		Image.Pixels.SetNumUninitialized(Width * Height);
+
+		const FImPlotColormapTable& Table = FImPlotColormapLut::Get(Colormap);
+		const FColor* Lut = Table.Colors.GetData();
+		const int32 LutLast = Table.Num() - 1;
+
+		const float Range = ScaleMax - ScaleMin;
+		const float LutScale = Range != 0.0f ? LutLast / Range : 0.0f;
+		FColor* Pixels = Image.Pixels.GetData();
+
+		const int32 NumTasks = ImPlotCache::GetNumTasks(Width * Height, FImPlotHeatmapRasterizer::MinTexelsPerTask);
+		ParallelFor(NumTasks, [&](int32 Task)
+		{
+			const int32 RowBegin = (int64)Height * Task / NumTasks;
+			const int32 RowEnd = (int64)Height * (Task + 1) / NumTasks;
+
+			for (int32 TexelY = RowBegin; TexelY < RowEnd; ++TexelY)
+			{
+				const int32 CellY0 = TexelY * CellsY;
+				const int32 CellY1 = FMath::Min(CellY0 + CellsY, Rows);
+				FColor* OutRow = Pixels + TexelY * Width;
+
+				for (int32 TexelX = 0; TexelX < Width; ++TexelX)
+				{
+					const int32 CellX0 = TexelX * CellsX;
+					const int32 CellX1 = FMath::Min(CellX0 + CellsX, Cols);
+
+					float Sum = 0.0f;
+					for (int32 CellY = CellY0; CellY < CellY1; ++CellY)
+					{
+						const T* Row = Values + CellY * Cols;
+						for (int32 CellX = CellX0; CellX < CellX1; ++CellX)
+						{
+							Sum += static_cast<float>(Row[CellX]);
+						}
+					}
+					const float Mean = Sum / ((CellY1 - CellY0) * (CellX1 - CellX0));
+					const int32 Index = FMath::Clamp(FMath::RoundToInt((Mean - ScaleMin) * LutScale), 0, LutLast);
+					OutRow[TexelX] = Lut[Index];
+				}
+			}
+		}, NumTasks == 1);
+
+		FImPlotHeatmapRasterizer::Upload(Image);
+		return true;
+	}
+}
+
+bool FImPlotHeatmapRasterizer::Rasterize(FImPlotHeatmapImage& Image, const float* Values, int32 Rows, int32 Cols, float ScaleMin, float ScaleMax, int32 Colormap, int32 MaxWidth, int32 MaxHeight, int32 DataVersion)
+{
+	return RasterizeGrid(Image, Values, Rows, Cols, ScaleMin, ScaleMax, Colormap, MaxWidth, MaxHeight, DataVersion);
+}
+
+bool FImPlotHeatmapRasterizer::Rasterize(FImPlotHeatmapImage& Image, const int32* Values, int32 Rows, int32 Cols, float ScaleMin, float ScaleMax, int32 Colormap, int32 MaxWidth, int32 MaxHeight, int32 DataVersion)
+{
+	return RasterizeGrid(Image, Values, Rows, Cols, ScaleMin, ScaleMax, Colormap, MaxWidth, MaxHeight, DataVersion);
+}
+
+void FImPlotHeatmapRasterizer::Upload(FImPlotHeatmapImage& Image)
+{
+	const int32 Width = Image.Width;
+	const int32 Height = Image.Height;
+	if (Width <= 0 || Height <= 0 || Image.Pixels.Num() != Width * Height)
+		return;
+
+	const int32 NumBytes = Image.Pixels.Num() * sizeof(FColor);
+
+	if (Image.Texture == nullptr || Image.Texture->GetSizeX() != Width || Image.Texture->GetSizeY() != Height)
+	{
+		FImGuiTextureCache::Get().Release(Image.Texture);
+		Image.TextureHandle = FImGuiTextureHandle();
+
+		UTexture2D* Texture = UTexture2D::CreateTransient(Width, Height, PF_B8G8R8A8);
+		if (Texture == nullptr)
+			return;
+
+		Texture->Filter = TF_Nearest;
+		Texture->AddressX = TA_Clamp;
+		Texture->AddressY = TA_Clamp;
+
+		FTexture2DMipMap& Mip = Texture->PlatformData->Mips[0];
+		FMemory::Memcpy(Mip.BulkData.Lock(LOCK_READ_WRITE), Image.Pixels.GetData(), NumBytes);
+		Mip.BulkData.Unlock();
+		Texture->UpdateResource();
+
+		Image.Texture = Texture;
+		Image.TextureHandle = FImGuiTextureCache::Get().FindOrRegister(Texture);
+		return;
+	}
+
+	// same size: stream the pixels into the existing resource, the copy and the region are freed on the render thread
+	uint8* Data = (uint8*)FMemory::Malloc(NumBytes);
+	FMemory::Memcpy(Data, Image.Pixels.GetData(), NumBytes);
+	FUpdateTextureRegion2D* Region = new FUpdateTextureRegion2D(0, 0, 0, 0, Width, Height);
+
+	Image.Texture->UpdateTextureRegions(0, 1, Region, Width * sizeof(FColor), sizeof(FColor), Data,
+		[](uint8* SrcData, const FUpdateTextureRegion2D* Regions)
+		{
+			FMemory::Free(SrcData);
+			delete Regions;
+		});
+}
+
+FIntPoint FImPlotHeatmapRasterizer::GetPixelFootprint(const ImPlotPoint& BoundsMin, const ImPlotPoint& BoundsMax)
+{
+	const ImVec2 P0 = ImPlot::PlotToPixels(BoundsMin);
+	const ImVec2 P1 = ImPlot::PlotToPixels(BoundsMax);
+	const int32 MaxSize = (int32)GetMax2DTextureDimension();
+	return FIntPoint(
+		FMath::Clamp(FMath::CeilToInt(FMath::Abs(P1.x - P0.x)), 1, MaxSize),
+		FMath::Clamp(FMath::CeilToInt(FMath::Abs(P1.y - P0.y)), 1, MaxSize));
+}
+
+void FImPlotHeatmapRasterizer::Plot(const char* LabelId, const FImPlotHeatmapImage& Image, const ImPlotPoint& BoundsMin, const ImPlotPoint& BoundsMax)
+{
+	if (!Image.TextureHandle.IsValid())
+		return;
+
+	// PlotImage maps uv (0, 0) to (min x, max y), so texel row 0 lands at the top like heatmap row 0
+	ImPlot::PlotImage(LabelId, Image.TextureHandle, BoundsMin, BoundsMax);
+}
@@ -0,0 +1,229 @@
+// Distributed under the MIT License (MIT) (see accompanying LICENSE file)
+
+
+#include "ImplotMappedSeries.h"
+
+#include "Async/MappedFileHandle.h"
+#include "HAL/FileManager.h"
+#include "HAL/PlatformFilemanager.h"
+#include "Misc/Paths.h"
+
+namespace
+{
+	constexpr int64 DataAlignment = 16;
+
+	int64 GetNamesEnd(uint32 NumColumns)
+	{
+		return sizeof(FImPlotSeriesFileHeader) + (int64)NumColumns * FImPlotSeriesFileHeader::NameSize;
+	}
+}
+
+FImPlotMappedSeriesFile::~FImPlotMappedSeriesFile()
+{
+	// the region has to go before the file handle
+	Region.Reset();
+	FileHandle.Reset();
+}
+
+TSharedPtr<FImPlotMappedSeriesFile> FImPlotMappedSeriesFile::Open(const FString& Filename)
+{
+	IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+	TUniquePtr<IMappedFileHandle> Handle(PlatformFile.OpenMapped(*Filename));
+	if (!Handle.IsValid())
+	{
+		UE_LOG(LogTemp, Warning, TEXT("ImPlot: cannot memory map '%s'."), *Filename);
+		return nullptr;
+	}
+
+	const int64 FileSize = Handle->GetFileSize();
+	if (FileSize < (int64)sizeof(FImPlotSeriesFileHeader))
+	{
+		UE_LOG(LogTemp, Warning, TEXT("ImPlot: '%s' is too small to be a series file."), *Filename);
+		return nullptr;
+	}
+
+	// maps the address range only, pages are read when they are first touched
+	TUniquePtr<IMappedFileRegion> Region(Handle->MapRegion(0, FileSize));
+	if (!Region.IsValid())
+	{
+		UE_LOG(LogTemp, Warning, TEXT("ImPlot: cannot map the contents of '%s'."), *Filename);
+		return nullptr;
+	}
+
+	const uint8* Base = Region->GetMappedPtr();
+	FImPlotSeriesFileHeader Header;
+	FMemory::Memcpy(&Header, Base, sizeof(Header));
+
+	// DataOffset is checked against the file size first, it also bounds the names before it; the row count
+	// is divided rather than multiplied, so no field can overflow the check
+	const bool bValidHeader = Header.Magic == FImPlotSeriesFileHeader::MagicValue
+		&& Header.Version == FImPlotSeriesFileHeader::CurrentVersion
+		&& Header.NumColumns > 0
+		&& (Header.ValueSize == sizeof(float) || Header.ValueSize == sizeof(double))
+		&& Header.DataOffset <= (uint64)FileSize
+		&& Header.DataOffset >= (uint64)GetNamesEnd(Header.NumColumns)
+		&& Header.DataOffset % Header.ValueSize == 0
+		&& Header.NumRows <= ((uint64)FileSize - Header.DataOffset) / ((uint64)Header.NumColumns * Header.ValueSize);
+	if (!bValidHeader)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("ImPlot: '%s' is not a valid series file or is truncated."), *Filename);
+		return nullptr;
+	}
+
+	TSharedPtr<FImPlotMappedSeriesFile> File(new FImPlotMappedSeriesFile());
+	File->Filename = Filename;
+	File->Header = Header;
+	File->Names.Reserve(Header.NumColumns);
+	for (uint32 Column = 0; Column < Header.NumColumns; ++Column)
+	{
+		const ANSICHAR* Name = reinterpret_cast<const ANSICHAR*>(Base + sizeof(Header) + Column * FImPlotSeriesFileHeader::NameSize);
+		const int32 Length = FCStringAnsi::Strnlen(Name, FImPlotSeriesFileHeader::NameSize);
+		const FUTF8ToTCHAR Converted(Name, Length);
+		File->Names.Add(FString(Converted.Length(), Converted.Get()));
+	}
+	File->Data = Base + Header.DataOffset;
+	File->Region = MoveTemp(Region);
+	File->FileHandle = MoveTemp(Handle);
+	return File;
+}
+
+bool FImPlotMappedSeriesFile::Write(const FString& Filename, const TArray<FString>& Names, const TArray<TArray<float>>& Columns)
+{
+	if (Columns.Num() == 0)
+		return false;
+
+	const int32 NumRows = Columns[0].Num();
+	for (const TArray<float>& Column : Columns)
+	{
+		if (Column.Num() != NumRows)
+			return false;
+	}
+
+	TUniquePtr<FArchive> Ar(IFileManager::Get().CreateFileWriter(*Filename));
+	if (!Ar.IsValid())
+		return false;
+
+	FImPlotSeriesFileHeader Header;
+	Header.NumColumns = Columns.Num();
+	Header.ValueSize = sizeof(float);
+	Header.NumRows = NumRows;
+	Header.DataOffset = Align(GetNamesEnd(Header.NumColumns), DataAlignment);
+	Ar->Serialize(&Header, sizeof(Header));
+
+	for (int32 Column = 0; Column < Columns.Num(); ++Column)
+	{
+		ANSICHAR Name[FImPlotSeriesFileHeader::NameSize] = {};
+		if (Names.IsValidIndex(Column))
+		{
+			const FTCHARToUTF8 Utf8(*Names[Column]);
+			FMemory::Memcpy(Name, Utf8.Get(), FMath::Min(Utf8.Length(), FImPlotSeriesFileHeader::NameSize - 1));
+		}
+		Ar->Serialize(Name, sizeof(Name));
+	}
+
+	uint8 Padding[DataAlignment] = {};
+	Ar->Serialize(Padding, Header.DataOffset - GetNamesEnd(Header.NumColumns));
+
+	for (const TArray<float>& Column : Columns)
+	{
+		Ar->Serialize(const_cast<float*>(Column.GetData()), Column.Num() * sizeof(float));
+	}
+	return Ar->Close();
+}
+
+FVector2D FImPlotMappedSeriesFile::GetXRange() const
+{
+	if (Header.NumRows == 0)
+		return FVector2D::ZeroVector;
+	return FVector2D(GetValue(0, 0), GetValue(0, Header.NumRows - 1));
+}
+
+double FImPlotMappedSeriesFile::GetValue(int32 Column, int64 Row) const
+{
+	const uint8* Ptr = GetColumn(Column) + Row * Header.ValueSize;
+	return Header.ValueSize == sizeof(double) ? *reinterpret_cast<const double*>(Ptr) : *reinterpret_cast<const float*>(Ptr);
+}
+
+bool FImPlotMappedSeriesFile::GetVisibleRows(int32 MaxPoints, int64& OutStart, int64& OutCount, int32& OutStride) const
+{
+	const int64 NumRows = (int64)Header.NumRows;
+	if (NumRows == 0)
+		return false;
+
+	// binary searches only touch log2(NumRows) pages of the X column
+	const ImPlotLimits Limits = ImPlot::GetPlotLimits();
+	auto LowerBound = [this, NumRows](double X, bool bInclusive)
+	{
+		int64 First = 0, Count = NumRows;
+		while (Count > 0)
+		{
+			const int64 Step = Count / 2;
+			const double Value = GetValue(0, First + Step);
+			if (bInclusive ? Value < X : Value <= X)
+			{
+				First += Step + 1;
+				Count -= Step + 1;
+			}
+			else
+			{
+				Count = Step;
+			}
+		}
+		return First;
+	};
+
+	// one extra point on each side so lines reach the plot edges
+	const int64 Start = FMath::Max<int64>(0, LowerBound(Limits.X.Min, true) - 1);
+	const int64 End = FMath::Min<int64>(NumRows, LowerBound(Limits.X.Max, false) + 1);
+	const int64 Count = End - Start;
+	if (Count <= 0)
+		return false;
+
+	const int64 Target = MaxPoints > 0 ? MaxPoints : FMath::Max(2, 2 * (int32)ImPlot::GetPlotSize().x);
+	const int64 MaxStride = MAX_int32 / Header.ValueSize;
+	const int64 Stride = FMath::Clamp<int64>((Count + Target - 1) / Target, 1, MaxStride);
+
+	OutStart = Start;
+	OutCount = (Count + Stride - 1) / Stride;
+	OutStride = (int32)Stride;
+	return OutCount <= MAX_int32;
+}
+
+template<typename T>
+void FImPlotMappedSeriesFile::PlotColumn(const char* LabelId, int32 Column, int32 MaxPoints, bool bScatter) const
+{
+	if (Column < 0 || Column >= (int32)Header.NumColumns)
+		return;
+
+	int64 Start, Count;
+	int32 Stride;
+	if (!GetVisibleRows(MaxPoints, Start, Count, Stride))
+		return;
+
+	const T* Xs = reinterpret_cast<const T*>(GetColumn(0)) + Start;
+	const T* Ys = reinterpret_cast<const T*>(GetColumn(Column)) + Start;
+	if (bScatter)
+	{
+		ImPlot::PlotScatter(LabelId, Xs, Ys, (int32)Count, 0, Stride * (int32)sizeof(T));
+	}
+	else
+	{
+		ImPlot::PlotLine(LabelId, Xs, Ys, (int32)Count, 0, Stride * (int32)sizeof(T));
+	}
+}
+
+void FImPlotMappedSeriesFile::PlotLine(const char* LabelId, int32 Column, int32 MaxPoints) const
+{
+	if (Header.ValueSize == sizeof(double))
+		PlotColumn<double>(LabelId, Column, MaxPoints, false);
+	else
+		PlotColumn<float>(LabelId, Column, MaxPoints, false);
+}
+
+void FImPlotMappedSeriesFile::PlotScatter(const char* LabelId, int32 Column, int32 MaxPoints) const
+{
+	if (Header.ValueSize == sizeof(double))
+		PlotColumn<double>(LabelId, Column, MaxPoints, true);
+	else
+		PlotColumn<float>(LabelId, Column, MaxPoints, true);
+}
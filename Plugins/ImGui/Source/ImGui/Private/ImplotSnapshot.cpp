@@ -0,0 +1,136 @@
+// Distributed under the MIT License (MIT) (see accompanying LICENSE file)
+
+
+#include "ImplotSnapshot.h"
+
+#include "Misc/CoreDelegates.h"
+#include "Misc/ScopeLock.h"
+
+namespace
+{
+	void CopyBuffer(const FScrollingBuffer& From, FScrollingBuffer& To)
+	{
+		// Reset + Append keeps the allocation, so steady state commits do not allocate
+		To.MaxSize = From.MaxSize;
+		To.Offset = From.Offset;
+		To.DataX.Reset();
+		To.DataX.Append(From.DataX);
+		To.DataY.Reset();
+		To.DataY.Append(From.DataY);
+		To.StatsX = From.StatsX;
+		To.StatsY = From.StatsY;
+		To.StatsFingerprint = From.StatsFingerprint;
+	}
+
+	TUniquePtr<FScrollingBuffer> MakeBuffer(int32 MaxSize)
+	{
+		TUniquePtr<FScrollingBuffer> Buffer = MakeUnique<FScrollingBuffer>();
+		Buffer->Initialized(MaxSize);
+		return Buffer;
+	}
+
+	struct FRegistryStorage
+	{
+		FCriticalSection Lock;
+		TArray<TWeakPtr<FImPlotSnapshotState, ESPMode::ThreadSafe>> States;
+		uint64 LastFlipFrame = MAX_uint64;
+		FDelegateHandle BeginFrameHandle;
+
+		~FRegistryStorage()
+		{
+			// on module unload the delegate outlives this code
+			FCoreDelegates::OnBeginFrame.Remove(BeginFrameHandle);
+		}
+	};
+
+	FRegistryStorage& GetRegistry()
+	{
+		static FRegistryStorage Registry;
+		return Registry;
+	}
+}
+
+FImPlotSnapshotState::FImPlotSnapshotState(int32 MaxSize)
+{
+	MaxSize = FMath::Max(1, MaxSize);
+	Back.Initialized(MaxSize);
+	Spare = MakeBuffer(MaxSize);
+	Pending = MakeBuffer(MaxSize);
+	Front = MakeBuffer(MaxSize);
+}
+
+void FImPlotSnapshotState::AddPoint(float X, float Y)
+{
+	FScopeLock Lock(&ProducerLock);
+	Back.AddPoint(X, Y);
+}
+
+void FImPlotSnapshotState::AddPoints(const float* Xs, const float* Ys, int32 Count)
+{
+	FScopeLock Lock(&ProducerLock);
+	Back.AddPoints(Xs, Ys, Count);
+}
+
+void FImPlotSnapshotState::Erase()
+{
+	FScopeLock Lock(&ProducerLock);
+	Back.Erase();
+}
+
+void FImPlotSnapshotState::Commit()
+{
+	FScopeLock Lock(&ProducerLock);
+	CopyBuffer(Back, *Spare);
+
+	FScopeLock Swap(&SwapLock);
+	::Swap(Spare, Pending);
+	bHasPending = true;
+}
+
+bool FImPlotSnapshotState::Flip()
+{
+	check(IsInGameThread());
+
+	FScopeLock Lock(&SwapLock);
+	if (!bHasPending)
+		return false;
+
+	// the old front becomes the next pending buffer, producers never touch the front
+	::Swap(Pending, Front);
+	bHasPending = false;
+	return true;
+}
+
+void FImPlotSnapshotRegistry::Register(const TSharedRef<FImPlotSnapshotState, ESPMode::ThreadSafe>& State)
+{
+	FRegistryStorage& Registry = GetRegistry();
+	FScopeLock Lock(&Registry.Lock);
+	Registry.States.Add(State);
+
+	// bound once, so the flip happens whichever code (and however many contexts) draws the plots
+	if (!Registry.BeginFrameHandle.IsValid())
+	{
+		Registry.BeginFrameHandle = FCoreDelegates::OnBeginFrame.AddStatic(&FImPlotSnapshotRegistry::FlipAll);
+	}
+}
+
+void FImPlotSnapshotRegistry::FlipAll()
+{
+	FRegistryStorage& Registry = GetRegistry();
+	if (Registry.LastFlipFrame == GFrameCounter)
+		return;
+	Registry.LastFlipFrame = GFrameCounter;
+
+	FScopeLock Lock(&Registry.Lock);
+	for (int32 i = Registry.States.Num() - 1; i >= 0; --i)
+	{
+		if (const TSharedPtr<FImPlotSnapshotState, ESPMode::ThreadSafe> State = Registry.States[i].Pin())
+		{
+			State->Flip();
+		}
+		else
+		{
+			Registry.States.RemoveAtSwap(i, 1, false);
+		}
+	}
+}
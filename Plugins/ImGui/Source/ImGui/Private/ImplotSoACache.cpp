@@ -0,0 +1,264 @@
+// Distributed under the MIT License (MIT) (see accompanying LICENSE file)
+
+
+#include "ImplotSoACache.h"
+
+#include "Async/ParallelFor.h"
+#include "ImplotCache.h"
+
+namespace
+{
+	struct FEntry
+	{
+		int32 Num = 0;
+		int32 NumComponents = 0;
+		int32 DataVersion = -1;
+		uint32 Fingerprint = 0;
+		TArray<float> Components; // X, then Y, then Z
+		FVector Min = FVector::ZeroVector;
+		FVector Max = FVector::ZeroVector;
+		uint64 LastUsedFrame = 0;
+	};
+
+	struct FCacheStorage
+	{
+		TMap<const void*, FEntry> Entries;
+		uint64 LastTrimFrame = 0;
+	};
+
+	FCacheStorage& GetStorage()
+	{
+		static FCacheStorage Storage;
+		return Storage;
+	}
+
+	void Trim(FCacheStorage& Storage)
+	{
+		if (Storage.LastTrimFrame == GFrameCounter)
+			return;
+		Storage.LastTrimFrame = GFrameCounter;
+
+		for (auto It = Storage.Entries.CreateIterator(); It; ++It)
+		{
+			if (It.Value().LastUsedFrame + FImPlotSoACache::MaxUnusedFrames < GFrameCounter)
+			{
+				It.RemoveCurrent();
+			}
+		}
+	}
+
+	FORCEINLINE float ReduceMin(VectorRegister V)
+	{
+		alignas(16) float F[4];
+		VectorStoreAligned(V, F);
+		return FMath::Min(FMath::Min(F[0], F[1]), FMath::Min(F[2], F[3]));
+	}
+
+	FORCEINLINE float ReduceMax(VectorRegister V)
+	{
+		alignas(16) float F[4];
+		VectorStoreAligned(V, F);
+		return FMath::Max(FMath::Max(F[0], F[1]), FMath::Max(F[2], F[3]));
+	}
+
+	// Runs #Kernel(Begin, End, Min, Max) over #Count items in parallel and merges the bounds of the tasks.
+	template<typename KernelType>
+	void ParallelTranspose(int32 Count, FVector& OutMin, FVector& OutMax, KernelType Kernel)
+	{
+		const int32 NumTasks = ImPlotCache::GetNumTasks(Count, FImPlotSoACache::MinValuesPerTask);
+		TArray<FVector, TInlineAllocator<32>> Mins, Maxs;
+		Mins.Init(FVector(MAX_flt), NumTasks);
+		Maxs.Init(FVector(-MAX_flt), NumTasks);
+
+		ParallelFor(NumTasks, [&](int32 Task)
+		{
+			const int32 Begin = (int64)Count * Task / NumTasks;
+			const int32 End = (int64)Count * (Task + 1) / NumTasks;
+			Kernel(Begin, End, Mins[Task], Maxs[Task]);
+		}, NumTasks == 1);
+
+		OutMin = FVector(MAX_flt);
+		OutMax = FVector(-MAX_flt);
+		for (int32 Task = 0; Task < NumTasks; ++Task)
+		{
+			OutMin = OutMin.ComponentMin(Mins[Task]);
+			OutMax = OutMax.ComponentMax(Maxs[Task]);
+		}
+		if (Count == 0)
+		{
+			OutMin = OutMax = FVector::ZeroVector;
+		}
+	}
+
+	void ScalarBounds(const TArray<FVector>& Values, FVector& OutMin, FVector& OutMax)
+	{
+		OutMin = Values.Num() > 0 ? FVector(MAX_flt) : FVector::ZeroVector;
+		OutMax = Values.Num() > 0 ? FVector(-MAX_flt) : FVector::ZeroVector;
+		for (const FVector& Value : Values)
+		{
+			OutMin = OutMin.ComponentMin(Value);
+			OutMax = OutMax.ComponentMax(Value);
+		}
+	}
+
+	void ScalarBounds(const TArray<FVector2D>& Values, FVector& OutMin, FVector& OutMax)
+	{
+		OutMin = Values.Num() > 0 ? FVector(MAX_flt, MAX_flt, 0.0f) : FVector::ZeroVector;
+		OutMax = Values.Num() > 0 ? FVector(-MAX_flt, -MAX_flt, 0.0f) : FVector::ZeroVector;
+		for (const FVector2D& Value : Values)
+		{
+			OutMin = OutMin.ComponentMin(FVector(Value, 0.0f));
+			OutMax = OutMax.ComponentMax(FVector(Value, 0.0f));
+		}
+	}
+
+	template<typename TVector>
+	FImPlotSoAView GetView(const TArray<TVector>& Values, int32 DataVersion)
+	{
+		constexpr int32 NumComponents = sizeof(TVector) / sizeof(float);
+		const float* Data = reinterpret_cast<const float*>(Values.GetData());
+
+		FImPlotSoAView View;
+		View.Num = Values.Num();
+		if (DataVersion < 0 || Values.Num() < FImPlotSoACache::MinCount)
+		{
+			View.X = Data + 0;
+			View.Y = Data + 1;
+			View.Z = NumComponents > 2 ? Data + 2 : nullptr;
+			View.Stride = sizeof(TVector);
+			ScalarBounds(Values, View.Min, View.Max);
+			return View;
+		}
+
+		FCacheStorage& Storage = GetStorage();
+		Trim(Storage);
+
+		const uint32 Fingerprint = ImPlotCache::SampleFingerprint(Data, Values.Num() * NumComponents);
+		FEntry& Entry = Storage.Entries.FindOrAdd(Values.GetData());
+		if (Entry.Num != Values.Num() || Entry.NumComponents != NumComponents || Entry.DataVersion != DataVersion || Entry.Fingerprint != Fingerprint)
+		{
+			Entry.Num = Values.Num();
+			Entry.NumComponents = NumComponents;
+			Entry.DataVersion = DataVersion;
+			Entry.Fingerprint = Fingerprint;
+			Entry.Components.SetNumUninitialized(Values.Num() * NumComponents, false);
+
+			float* Out = Entry.Components.GetData();
+			if (NumComponents > 2)
+			{
+				FImPlotSoACache::Transpose(reinterpret_cast<const FVector*>(Values.GetData()), Values.Num(), Out, Out + Values.Num(), Out + 2 * Values.Num(), Entry.Min, Entry.Max);
+			}
+			else
+			{
+				FImPlotSoACache::Transpose(reinterpret_cast<const FVector2D*>(Values.GetData()), Values.Num(), Out, Out + Values.Num(), Entry.Min, Entry.Max);
+			}
+		}
+		Entry.LastUsedFrame = GFrameCounter;
+
+		const float* Components = Entry.Components.GetData();
+		View.X = Components;
+		View.Y = Components + Values.Num();
+		View.Z = NumComponents > 2 ? Components + 2 * Values.Num() : nullptr;
+		View.Min = Entry.Min;
+		View.Max = Entry.Max;
+		return View;
+	}
+}
+
+void FImPlotSoACache::Transpose(const FVector* Values, int32 Count, float* OutX, float* OutY, float* OutZ, FVector& OutMin, FVector& OutMax)
+{
+	ParallelTranspose(Count, OutMin, OutMax, [&](int32 Begin, int32 End, FVector& Min, FVector& Max)
+	{
+		const float* In = reinterpret_cast<const float*>(Values);
+		VectorRegister MinX = VectorSetFloat1(MAX_flt), MinY = MinX, MinZ = MinX;
+		VectorRegister MaxX = VectorSetFloat1(-MAX_flt), MaxY = MaxX, MaxZ = MaxX;
+
+		int32 i = Begin;
+		for (; i + 4 <= End; i += 4)
+		{
+			// 4 vectors in 3 registers: (x0 y0 z0 x1) (y1 z1 x2 y2) (z2 x3 y3 z3)
+			const VectorRegister R0 = VectorLoad(In + i * 3 + 0);
+			const VectorRegister R1 = VectorLoad(In + i * 3 + 4);
+			const VectorRegister R2 = VectorLoad(In + i * 3 + 8);
+
+			const VectorRegister X2Y2Z2X3 = VectorShuffle(R1, R2, 2, 3, 0, 1);
+			const VectorRegister Y0Z0Y1Z1 = VectorShuffle(R0, R1, 1, 2, 0, 1);
+			const VectorRegister Y2Y2Y3Y3 = VectorShuffle(R1, R2, 3, 3, 2, 2);
+
+			const VectorRegister X = VectorShuffle(R0, X2Y2Z2X3, 0, 3, 0, 3);
+			const VectorRegister Y = VectorShuffle(Y0Z0Y1Z1, Y2Y2Y3Y3, 0, 2, 0, 2);
+			const VectorRegister Z = VectorShuffle(Y0Z0Y1Z1, R2, 1, 3, 0, 3);
+
+			VectorStore(X, OutX + i);
+			VectorStore(Y, OutY + i);
+			VectorStore(Z, OutZ + i);
+
+			MinX = VectorMin(MinX, X); MaxX = VectorMax(MaxX, X);
+			MinY = VectorMin(MinY, Y); MaxY = VectorMax(MaxY, Y);
+			MinZ = VectorMin(MinZ, Z); MaxZ = VectorMax(MaxZ, Z);
+		}
+
+		Min = FVector(ReduceMin(MinX), ReduceMin(MinY), ReduceMin(MinZ));
+		Max = FVector(ReduceMax(MaxX), ReduceMax(MaxY), ReduceMax(MaxZ));
+		for (; i < End; ++i)
+		{
+			OutX[i] = Values[i].X;
+			OutY[i] = Values[i].Y;
+			OutZ[i] = Values[i].Z;
+			Min = Min.ComponentMin(Values[i]);
+			Max = Max.ComponentMax(Values[i]);
+		}
+	});
+}
+
+void FImPlotSoACache::Transpose(const FVector2D* Values, int32 Count, float* OutX, float* OutY, FVector& OutMin, FVector& OutMax)
+{
+	ParallelTranspose(Count, OutMin, OutMax, [&](int32 Begin, int32 End, FVector& Min, FVector& Max)
+	{
+		const float* In = reinterpret_cast<const float*>(Values);
+		VectorRegister MinX = VectorSetFloat1(MAX_flt), MinY = MinX;
+		VectorRegister MaxX = VectorSetFloat1(-MAX_flt), MaxY = MaxX;
+
+		int32 i = Begin;
+		for (; i + 4 <= End; i += 4)
+		{
+			// 4 vectors in 2 registers: (x0 y0 x1 y1) (x2 y2 x3 y3)
+			const VectorRegister R0 = VectorLoad(In + i * 2 + 0);
+			const VectorRegister R1 = VectorLoad(In + i * 2 + 4);
+
+			const VectorRegister X = VectorShuffle(R0, R1, 0, 2, 0, 2);
+			const VectorRegister Y = VectorShuffle(R0, R1, 1, 3, 1, 3);
+
+			VectorStore(X, OutX + i);
+			VectorStore(Y, OutY + i);
+
+			MinX = VectorMin(MinX, X); MaxX = VectorMax(MaxX, X);
+			MinY = VectorMin(MinY, Y); MaxY = VectorMax(MaxY, Y);
+		}
+
+		Min = FVector(ReduceMin(MinX), ReduceMin(MinY), 0.0f);
+		Max = FVector(ReduceMax(MaxX), ReduceMax(MaxY), 0.0f);
+		for (; i < End; ++i)
+		{
+			OutX[i] = Values[i].X;
+			OutY[i] = Values[i].Y;
+			Min = Min.ComponentMin(FVector(Values[i], 0.0f));
+			Max = Max.ComponentMax(FVector(Values[i], 0.0f));
+		}
+	});
+}
+
+FImPlotSoAView FImPlotSoACache::Get(const TArray<FVector>& Values, int32 DataVersion)
+{
+	return GetView(Values, DataVersion);
+}
+
+FImPlotSoAView FImPlotSoACache::Get(const TArray<FVector2D>& Values, int32 DataVersion)
+{
+	return GetView(Values, DataVersion);
+}
+
+void FImPlotSoACache::Reset()
+{
+	GetStorage().Entries.Reset();
+}
@@ -0,0 +1,685 @@
+// Distributed under the MIT License (MIT) (see accompanying LICENSE file)
+
+
+#include "ImplotTelemetry.h"
+
+#include "Algo/BinarySearch.h"
+#include "Async/Async.h"
+#include "HAL/FileManager.h"
+#include "HAL/Runnable.h"
+#include "HAL/RunnableThread.h"
+#include "HAL/ThreadSafeCounter.h"
+#include "Containers/Queue.h"
+#include "Misc/Compression.h"
+#include "Misc/CoreDelegates.h"
+#include "Misc/Paths.h"
+#include "Misc/ScopeLock.h"
+
+namespace
+{
+	enum class ERecordType : uint8
+	{
+		Channel = 0,
+		Chunk = 1
+	};
+}
+
+//-----------------------------------------------------------------------------
+// Writer
+//-----------------------------------------------------------------------------
+
+// Writer thread of a recorder, and everything it touches. Outlives the recorder when stopped.
+class FImPlotTelemetryWriter : public FRunnable
+{
+public:
+
+	struct FJob
+	{
+		int32 Channel = 0;
+		FString Name; // set for channel records
+		TArray<float> X;
+		TArray<float> Y;
+	};
+
+	explicit FImPlotTelemetryWriter(const FString& InFilename)
+		: Filename(InFilename)
+	{
+		WorkEvent = FPlatformProcess::GetSynchEventFromPool();
+	}
+
+	virtual ~FImPlotTelemetryWriter()
+	{
+		check(Thread == nullptr);
+		FPlatformProcess::ReturnSynchEventToPool(WorkEvent);
+	}
+
+	void Enqueue(TUniquePtr<FJob>&& Job)
+	{
+		Jobs.Enqueue(MoveTemp(Job));
+		WorkEvent->Trigger();
+	}
+
+	// FRunnable
+	virtual uint32 Run() override;
+
+	FString Filename;
+
+	TQueue<TUniquePtr<FJob>, EQueueMode::Spsc> Jobs;
+	FEvent* WorkEvent = nullptr;
+	FRunnableThread* Thread = nullptr;
+	FThreadSafeBool bStopping;
+	FThreadSafeBool bFinished;
+	FThreadSafeBool bFailed;
+
+	FThreadSafeCounter PendingChunks;
+	FThreadSafeCounter WrittenChunks;
+	FThreadSafeCounter DroppedChunks;
+
+private:
+
+	void WriteJob(FArchive& Ar, FJob& Job);
+};
+
+namespace
+{
+	// Writers of stopped recorders, still draining their queue. Their threads are joined on the game thread:
+	// the finished ones whenever another recorder stops, the rest before exit.
+	struct FRetiredWriters
+	{
+		TArray<TSharedPtr<FImPlotTelemetryWriter, ESPMode::ThreadSafe>> Writers;
+		FDelegateHandle PreExitHandle;
+
+		FRetiredWriters()
+		{
+			PreExitHandle = FCoreDelegates::OnPreExit.AddRaw(this, &FRetiredWriters::Reap, true);
+		}
+
+		~FRetiredWriters()
+		{
+			FCoreDelegates::OnPreExit.Remove(PreExitHandle);
+			Reap(true);
+		}
+
+		void Retire(const TSharedPtr<FImPlotTelemetryWriter, ESPMode::ThreadSafe>& Writer)
+		{
+			Reap(false);
+			Writers.Add(Writer);
+		}
+
+		void Reap(bool bWait)
+		{
+			for (int32 i = Writers.Num() - 1; i >= 0; --i)
+			{
+				FImPlotTelemetryWriter& Writer = *Writers[i];
+				if (bWait || Writer.bFinished)
+				{
+					Writer.Thread->WaitForCompletion();
+					delete Writer.Thread;
+					Writer.Thread = nullptr;
+					Writers.RemoveAtSwap(i);
+				}
+			}
+		}
+	};
+
+	FRetiredWriters& GetRetiredWriters()
+	{
+		static FRetiredWriters RetiredWriters;
+		return RetiredWriters;
+	}
+}
+
+void FImPlotTelemetryWriter::WriteJob(FArchive& Ar, FJob& Job)
+{
+	if (Job.X.Num() == 0)
+	{
+		uint8 Type = (uint8)ERecordType::Channel;
+		Ar << Type;
+		Ar << Job.Channel;
+		FTCHARToUTF8 Utf8(*Job.Name);
+		int32 Length = Utf8.Length();
+		Ar << Length;
+		Ar.Serialize(const_cast<ANSICHAR*>(Utf8.Get()), Length);
+		return;
+	}
+
+	// columnar payload: all X values, then all Y values
+	int32 NumSamples = Job.X.Num();
+	TArray<uint8> Raw;
+	Raw.SetNumUninitialized(NumSamples * sizeof(float) * 2);
+	FMemory::Memcpy(Raw.GetData(), Job.X.GetData(), NumSamples * sizeof(float));
+	FMemory::Memcpy(Raw.GetData() + NumSamples * sizeof(float), Job.Y.GetData(), NumSamples * sizeof(float));
+
+	double XMin = TNumericLimits<double>::Max();
+	double XMax = TNumericLimits<double>::Lowest();
+	for (const float X : Job.X)
+	{
+		XMin = FMath::Min<double>(XMin, X);
+		XMax = FMath::Max<double>(XMax, X);
+	}
+
+	int32 RawSize = Raw.Num();
+	TArray<uint8> Compressed;
+	int32 StoredSize = FCompression::CompressMemoryBound(NAME_Zlib, RawSize);
+	Compressed.SetNumUninitialized(StoredSize);
+	const bool bCompressed = FCompression::CompressMemory(NAME_Zlib, Compressed.GetData(), StoredSize, Raw.GetData(), RawSize) && StoredSize < RawSize;
+	if (!bCompressed)
+	{
+		StoredSize = RawSize;
+	}
+
+	uint8 Type = (uint8)ERecordType::Chunk;
+	Ar << Type;
+	Ar << Job.Channel;
+	Ar << NumSamples;
+	Ar << XMin;
+	Ar << XMax;
+	Ar << RawSize;
+	Ar << StoredSize;
+	Ar.Serialize(bCompressed ? Compressed.GetData() : Raw.GetData(), StoredSize);
+}
+
+uint32 FImPlotTelemetryWriter::Run()
+{
+	IFileManager::Get().MakeDirectory(*FPaths::GetPath(Filename), true);
+	TUniquePtr<FArchive> Ar(IFileManager::Get().CreateFileWriter(*Filename));
+	if (Ar.IsValid())
+	{
+		uint32 Magic = ImPlotTelemetry::Magic;
+		uint32 Version = ImPlotTelemetry::Version;
+		*Ar << Magic;
+		*Ar << Version;
+	}
+	else
+	{
+		UE_LOG(LogTemp, Warning, TEXT("ImPlot: cannot open telemetry file '%s' for writing."), *Filename);
+		bFailed = true;
+	}
+
+	for (;;)
+	{
+		const bool bWasStopping = bStopping;
+
+		TUniquePtr<FJob> Job;
+		while (Jobs.Dequeue(Job))
+		{
+			const bool bChunk = Job->X.Num() > 0;
+			if (Ar.IsValid())
+			{
+				WriteJob(*Ar, *Job);
+			}
+			if (bChunk)
+			{
+				PendingChunks.Decrement();
+				if (Ar.IsValid())
+					WrittenChunks.Increment();
+				else
+					DroppedChunks.Increment();
+			}
+		}
+
+		// everything queued before the stop request has been written
+		if (bWasStopping)
+			break;
+
+		if (Ar.IsValid())
+		{
+			Ar->Flush();
+		}
+		WorkEvent->Wait(100);
+	}
+
+	if (Ar.IsValid() && !Ar->Close())
+	{
+		bFailed = true;
+	}
+	bFinished = true;
+	return 0;
+}
+
+//-----------------------------------------------------------------------------
+// Recorder
+//-----------------------------------------------------------------------------
+
+FImPlotTelemetryRecorder::FImPlotTelemetryRecorder(const FString& InFilename, int32 InChunkSamples, int32 InMaxPendingChunks)
+	: ChunkSamples(FMath::Max(64, InChunkSamples))
+	, MaxPendingChunks(FMath::Max(1, InMaxPendingChunks))
+	, Writer(MakeShared<FImPlotTelemetryWriter, ESPMode::ThreadSafe>(InFilename))
+{
+	Writer->Thread = FRunnableThread::Create(Writer.Get(), TEXT("ImPlotTelemetryRecorder"), 0, TPri_BelowNormal);
+	if (Writer->Thread == nullptr)
+	{
+		Writer->bFailed = true;
+	}
+}
+
+FImPlotTelemetryRecorder::~FImPlotTelemetryRecorder()
+{
+	Stop();
+}
+
+FImPlotTelemetryRecorder::FChannel& FImPlotTelemetryRecorder::FindOrAddChannel(FName Channel)
+{
+	if (FChannel* State = Channels.Find(Channel))
+		return *State;
+
+	FChannel& State = Channels.Add(Channel);
+	State.Index = Channels.Num() - 1;
+	State.X.Reserve(ChunkSamples);
+	State.Y.Reserve(ChunkSamples);
+
+	// channel records are tiny and never dropped, so every chunk can be attributed
+	TUniquePtr<FImPlotTelemetryWriter::FJob> Job = MakeUnique<FImPlotTelemetryWriter::FJob>();
+	Job->Channel = State.Index;
+	Job->Name = Channel.ToString();
+	Writer->Enqueue(MoveTemp(Job));
+	return State;
+}
+
+void FImPlotTelemetryRecorder::Append(FChannel& State, float X, float Y)
+{
+	State.X.Add(X);
+	State.Y.Add(Y);
+	State.LastX = X;
+	if (State.X.Num() >= ChunkSamples)
+	{
+		Submit(State);
+	}
+}
+
+void FImPlotTelemetryRecorder::Submit(FChannel& State)
+{
+	if (State.X.Num() == 0)
+		return;
+
+	if (Writer->Thread == nullptr || Writer->bStopping || Writer->PendingChunks.GetValue() >= MaxPendingChunks)
+	{
+		// the disk is behind (or gone): drop rather than grow or wait
+		Writer->DroppedChunks.Increment();
+		State.X.Reset();
+		State.Y.Reset();
+		return;
+	}
+
+	TUniquePtr<FImPlotTelemetryWriter::FJob> Job = MakeUnique<FImPlotTelemetryWriter::FJob>();
+	Job->Channel = State.Index;
+	Job->X = MoveTemp(State.X);
+	Job->Y = MoveTemp(State.Y);
+	State.X.Reserve(ChunkSamples);
+	State.Y.Reserve(ChunkSamples);
+
+	Writer->PendingChunks.Increment();
+	Writer->Enqueue(MoveTemp(Job));
+}
+
+void FImPlotTelemetryRecorder::Record(FName Channel, float X, float Y)
+{
+	Append(FindOrAddChannel(Channel), X, Y);
+}
+
+void FImPlotTelemetryRecorder::RecordScrollingBuffer(FName Channel, const FScrollingBuffer& Buffer)
+{
+	FChannel& State = FindOrAddChannel(Channel);
+	const int32 Num = FMath::Min(Buffer.DataX.Num(), Buffer.DataY.Num());
+	if (Num == 0)
+		return;
+
+	// oldest sample first: once the ring is full it starts at Offset
+	const int32 Start = Num < Buffer.MaxSize ? 0 : Buffer.Offset % Num;
+	for (int32 k = 0; k < Num; ++k)
+	{
+		const int32 i = (Start + k) % Num;
+		if (Buffer.DataX[i] > State.LastX)
+		{
+			Append(State, Buffer.DataX[i], Buffer.DataY[i]);
+		}
+	}
+}
+
+void FImPlotTelemetryRecorder::RecordRollingBuffer(FName Channel, const FRollingBuffer& Buffer)
+{
+	FChannel& State = FindOrAddChannel(Channel);
+	const int32 Num = FMath::Min(Buffer.DataX.Num(), Buffer.DataY.Num());
+
+	// same cycle if the last recorded sample is still where it was
+	const bool bSameCycle = State.RollingNum > 0 && Num >= State.RollingNum && Buffer.DataX[State.RollingNum - 1] == State.RollingLastX;
+	int32 First = State.RollingNum;
+	if (!bSameCycle)
+	{
+		if (State.RollingNum > 0)
+		{
+			State.RollingBase += Buffer.Span;
+		}
+		First = 0;
+	}
+
+	for (int32 i = First; i < Num; ++i)
+	{
+		Append(State, static_cast<float>(State.RollingBase + Buffer.DataX[i]), Buffer.DataY[i]);
+	}
+
+	State.RollingNum = Num;
+	State.RollingLastX = Num > 0 ? Buffer.DataX[Num - 1] : 0.0f;
+}
+
+void FImPlotTelemetryRecorder::Flush()
+{
+	for (TPair<FName, FChannel>& Pair : Channels)
+	{
+		Submit(Pair.Value);
+	}
+}
+
+void FImPlotTelemetryRecorder::Stop()
+{
+	if (Writer->bStopping)
+		return;
+
+	Flush();
+	Writer->bStopping = true;
+	if (Writer->Thread)
+	{
+		Writer->WorkEvent->Trigger();
+		GetRetiredWriters().Retire(Writer);
+	}
+}
+
+int32 FImPlotTelemetryRecorder::GetWrittenChunks() const
+{
+	return Writer->WrittenChunks.GetValue();
+}
+
+int32 FImPlotTelemetryRecorder::GetDroppedChunks() const
+{
+	return Writer->DroppedChunks.GetValue();
+}
+
+int32 FImPlotTelemetryRecorder::GetPendingChunks() const
+{
+	return Writer->PendingChunks.GetValue();
+}
+
+bool FImPlotTelemetryRecorder::HasFailed() const
+{
+	return Writer->bFailed;
+}
+
+//-----------------------------------------------------------------------------
+// Replay
+//-----------------------------------------------------------------------------
+
+FImPlotTelemetryReplay::FImPlotTelemetryReplay(const FString& InFilename, int32 InMaxCachedChunks)
+	: Filename(InFilename)
+	, MaxCachedChunks(FMath::Max(4, InMaxCachedChunks))
+{
+}
+
+TSharedPtr<FImPlotTelemetryReplay, ESPMode::ThreadSafe> FImPlotTelemetryReplay::Open(const FString& Filename, int32 MaxCachedChunks)
+{
+	TSharedPtr<FImPlotTelemetryReplay, ESPMode::ThreadSafe> Replay(new FImPlotTelemetryReplay(Filename, MaxCachedChunks));
+	Async(EAsyncExecution::ThreadPool, [Replay]()
+	{
+		Replay->BuildIndex();
+	});
+	return Replay;
+}
+
+void FImPlotTelemetryReplay::BuildIndex()
+{
+	FScopeLock ReadLock(&ReaderLock);
+	Reader.Reset(IFileManager::Get().CreateFileReader(*Filename));
+	if (!Reader.IsValid())
+	{
+		UE_LOG(LogTemp, Warning, TEXT("ImPlot: cannot open telemetry file '%s'."), *Filename);
+		bFailed = true;
+		return;
+	}
+
+	FArchive& Ar = *Reader;
+	uint32 Magic = 0, Version = 0;
+	Ar << Magic;
+	Ar << Version;
+	if (Magic != ImPlotTelemetry::Magic || Version != ImPlotTelemetry::Version)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("ImPlot: '%s' is not a telemetry file."), *Filename);
+		bFailed = true;
+		return;
+	}
+
+	TMap<int32, FName> ChannelNames;
+	double TimeMin = TNumericLimits<double>::Max();
+	double TimeMax = TNumericLimits<double>::Lowest();
+	const int64 FileSize = Ar.TotalSize();
+
+	// only record headers are read, payloads are skipped
+	while (Ar.Tell() < FileSize && !Ar.IsError())
+	{
+		uint8 Type = 0;
+		int32 Channel = 0;
+		Ar << Type;
+		Ar << Channel;
+
+		if (Type == (uint8)ERecordType::Channel)
+		{
+			int32 Length = 0;
+			Ar << Length;
+			if (Length < 0 || Ar.Tell() + Length > FileSize)
+				break;
+			TArray<ANSICHAR> Name;
+			Name.SetNumZeroed(Length + 1);
+			Ar.Serialize(Name.GetData(), Length);
+			ChannelNames.Add(Channel, FName(UTF8_TO_TCHAR(Name.GetData())));
+			continue;
+		}
+
+		if (Type != (uint8)ERecordType::Chunk)
+			break;
+
+		FChunkInfo Chunk;
+		Ar << Chunk.NumSamples;
+		Ar << Chunk.XMin;
+		Ar << Chunk.XMax;
+		Ar << Chunk.RawSize;
+		Ar << Chunk.StoredSize;
+		Chunk.Offset = Ar.Tell();
+
+		// a truncated last chunk ends the index (the sample count is bounded first, so the raw size cannot overflow)
+		if (Ar.IsError() || Chunk.NumSamples < 0 || Chunk.NumSamples > MAX_int32 / ((int32)sizeof(float) * 2)
+			|| Chunk.StoredSize < 0 || Chunk.Offset + Chunk.StoredSize > FileSize || Chunk.RawSize != Chunk.NumSamples * (int32)sizeof(float) * 2)
+			break;
+
+		if (const FName* Name = ChannelNames.Find(Channel))
+		{
+			Index.FindOrAdd(*Name).Add(Chunk);
+			TimeMin = FMath::Min(TimeMin, Chunk.XMin);
+			TimeMax = FMath::Max(TimeMax, Chunk.XMax);
+		}
+		Ar.Seek(Chunk.Offset + Chunk.StoredSize);
+	}
+
+	// chunks of a channel are written in order, but keep the lookup robust against out of order X
+	for (TPair<FName, TArray<FChunkInfo>>& Pair : Index)
+	{
+		Pair.Value.StableSort([](const FChunkInfo& A, const FChunkInfo& B) { return A.XMin < B.XMin; });
+	}
+
+	TimeRange = Index.Num() > 0 ? FVector2D(TimeMin, TimeMax) : FVector2D::ZeroVector;
+	bReady = true;
+}
+
+TArray<FName> FImPlotTelemetryReplay::GetChannels() const
+{
+	TArray<FName> Channels;
+	if (bReady)
+	{
+		Index.GetKeys(Channels);
+	}
+	return Channels;
+}
+
+FVector2D FImPlotTelemetryReplay::GetTimeRange() const
+{
+	return bReady ? TimeRange : FVector2D::ZeroVector;
+}
+
+void FImPlotTelemetryReplay::RequestChunk(const FChunkInfo& Chunk)
+{
+	{
+		FScopeLock Lock(&CacheLock);
+		if (Loading.Contains(Chunk.Offset))
+			return;
+		Loading.Add(Chunk.Offset);
+	}
+
+	TWeakPtr<FImPlotTelemetryReplay, ESPMode::ThreadSafe> WeakThis = AsShared();
+	Async(EAsyncExecution::ThreadPool, [WeakThis, Chunk]()
+	{
+		const TSharedPtr<FImPlotTelemetryReplay, ESPMode::ThreadSafe> This = WeakThis.Pin();
+		if (!This.IsValid())
+			return;
+
+		TArray<uint8> Stored;
+		Stored.SetNumUninitialized(Chunk.StoredSize);
+		bool bValid;
+		{
+			FScopeLock ReadLock(&This->ReaderLock);
+			This->Reader->Seek(Chunk.Offset);
+			This->Reader->Serialize(Stored.GetData(), Chunk.StoredSize);
+
+			// a failed read leaves the archive in error, later reads would fail too
+			bValid = !This->Reader->IsError();
+			This->Reader->ClearError();
+		}
+
+		TArray<uint8> Raw;
+		if (bValid && Chunk.StoredSize == Chunk.RawSize)
+		{
+			Raw = MoveTemp(Stored);
+		}
+		else if (bValid)
+		{
+			Raw.SetNumUninitialized(Chunk.RawSize);
+			bValid = FCompression::UncompressMemory(NAME_Zlib, Raw.GetData(), Chunk.RawSize, Stored.GetData(), Chunk.StoredSize);
+		}
+
+		TSharedPtr<FDecodedChunk, ESPMode::ThreadSafe> Decoded = MakeShared<FDecodedChunk, ESPMode::ThreadSafe>();
+		if (bValid)
+		{
+			const int32 Bytes = Chunk.NumSamples * sizeof(float);
+			Decoded->X.SetNumUninitialized(Chunk.NumSamples);
+			Decoded->Y.SetNumUninitialized(Chunk.NumSamples);
+			FMemory::Memcpy(Decoded->X.GetData(), Raw.GetData(), Bytes);
+			FMemory::Memcpy(Decoded->Y.GetData(), Raw.GetData() + Bytes, Bytes);
+		}
+
+		// a corrupt chunk is cached empty so it is not requested again
+		FScopeLock Lock(&This->CacheLock);
+		This->Loading.Remove(Chunk.Offset);
+		This->Cache.Add(Chunk.Offset, Decoded);
+	});
+}
+
+bool FImPlotTelemetryReplay::Fill(FName Channel, double TimeMin, double TimeMax, FScrollingBuffer& Out, int32 MaxPoints)
+{
+	Out.DataX.Reset();
+	Out.DataY.Reset();
+	Out.Offset = 0;
+
+	const TArray<FChunkInfo>* Chunks = bReady ? Index.Find(Channel) : nullptr;
+	if (Chunks == nullptr)
+		return bReady;
+
+	// first chunk that can overlap the window
+	const int32 First = Algo::LowerBound(*Chunks, TimeMin, [](const FChunkInfo& Chunk, double Time) { return Chunk.XMax < Time; });
+
+	TArray<TSharedPtr<FDecodedChunk, ESPMode::ThreadSafe>, TInlineAllocator<16>> Visible;
+	bool bComplete = true;
+	{
+		FScopeLock Lock(&CacheLock);
+		for (int32 c = First; c < Chunks->Num() && (*Chunks)[c].XMin <= TimeMax; ++c)
+		{
+			const FChunkInfo& Chunk = (*Chunks)[c];
+			if (Chunk.XMax < TimeMin)
+				continue;
+
+			if (const TSharedPtr<FDecodedChunk, ESPMode::ThreadSafe>* Decoded = Cache.Find(Chunk.Offset))
+			{
+				(*Decoded)->LastUsedFrame = GFrameCounter;
+				Visible.Add(*Decoded);
+			}
+			else
+			{
+				bComplete = false;
+			}
+		}
+	}
+
+	// request what is missing (outside the lock, RequestChunk takes it)
+	if (!bComplete)
+	{
+		for (int32 c = First; c < Chunks->Num() && (*Chunks)[c].XMin <= TimeMax; ++c)
+		{
+			const FChunkInfo& Chunk = (*Chunks)[c];
+			if (Chunk.XMax < TimeMin)
+				continue;
+
+			bool bCached;
+			{
+				FScopeLock Lock(&CacheLock);
+				bCached = Cache.Contains(Chunk.Offset);
+			}
+			if (!bCached)
+			{
+				RequestChunk(Chunk);
+			}
+		}
+	}
+
+	int32 Total = 0;
+	for (const TSharedPtr<FDecodedChunk, ESPMode::ThreadSafe>& Decoded : Visible)
+	{
+		Total += Decoded->X.Num();
+	}
+	const int32 Stride = MaxPoints > 0 ? FMath::Max(1, FMath::DivideAndRoundUp(Total, MaxPoints)) : 1;
+
+	Out.DataX.Reserve(Total / Stride + 1);
+	Out.DataY.Reserve(Total / Stride + 1);
+	int32 Counter = 0;
+	for (const TSharedPtr<FDecodedChunk, ESPMode::ThreadSafe>& Decoded : Visible)
+	{
+		for (int32 i = 0; i < Decoded->X.Num(); ++i)
+		{
+			const float X = Decoded->X[i];
+			if (X < TimeMin || X > TimeMax || (Counter++ % Stride) != 0)
+				continue;
+			Out.DataX.Add(X);
+			Out.DataY.Add(Decoded->Y[i]);
+		}
+	}
+	Out.MaxSize = FMath::Max(1, Out.DataX.Num());
+	Out.RebuildStats();
+
+	Trim();
+	return bComplete;
+}
+
+void FImPlotTelemetryReplay::Trim()
+{
+	FScopeLock Lock(&CacheLock);
+	if (Cache.Num() <= MaxCachedChunks)
+		return;
+
+	// evict the least recently used chunks, never the ones used this frame
+	Cache.ValueSort([](const TSharedPtr<FDecodedChunk, ESPMode::ThreadSafe>& A, const TSharedPtr<FDecodedChunk, ESPMode::ThreadSafe>& B)
+	{
+		return A->LastUsedFrame > B->LastUsedFrame;
+	});
+	int32 Kept = 0;
+	for (auto It = Cache.CreateIterator(); It; ++It)
+	{
+		if (++Kept > MaxCachedChunks && It.Value()->LastUsedFrame != GFrameCounter)
+		{
+			It.RemoveCurrent();
+		}
+	}
+}
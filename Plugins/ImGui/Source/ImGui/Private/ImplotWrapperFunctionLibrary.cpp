@@ -3,6 +3,8 @@
 
 #include "ImplotWrapperFunctionLibrary.h"
 
+#include "ImplotDistribution.h"
+
 static TArray<TArray<float>> TwoDimensionalArray;
 const FLinearColor UImplotWrapperFunctionLibrary::UE_IMPLOT_AUTO_COL(0.f,0.f,0.f, -1.0f);
 
@@ -77,33 +79,7 @@ void ParseProperty(FProperty* Property, void* ValuePtr)
 
 void UImplotFunction::MakeNormalDistribution(FNormalDistribution& distribution, float mean, float sd)
 {
-    auto RandomGauss = []()
-    {
-        static double V1, V2, S;
-        static int phase = 0;
-        double X;
-        if(phase == 0) {
-            do {
-                double U1 = (double)FMath::Rand() / RAND_MAX;
-                double U2 = (double)FMath::Rand() / RAND_MAX;
-                V1 = 2 * U1 - 1;
-                V2 = 2 * U2 - 1;
-                S = V1 * V1 + V2 * V2;
-            } while(S >= 1 || S == 0);
-
-            X = V1 * sqrt(-2 * log(S) / S);
-        } else
-            X = V2 * sqrt(-2 * log(S) / S);
-        phase = 1 - phase;
-        return X;
-    };
-    
-    distribution.Data.Empty();
-    distribution.Data.SetNumZeroed(distribution.count);
-    for (int i = 0; i < distribution.count; ++i)
-    {
-        distribution.Data[i] = RandomGauss()*sd + mean;
-    }
+    FImPlotDistribution::Generate(distribution.Data, EImPlotDistribution::Normal, distribution.count, distribution.Seed, mean, sd);
 }
 
 int32 UImplotFunction::Conv_ImPlotMarkerToInt(EImPlotMarker ImPlotMarker)
@@ -0,0 +1,83 @@
+// Distributed under the MIT License (MIT) (see accompanying LICENSE file)
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/Runnable.h"
+#include "HAL/ThreadSafeBool.h"
+#include "HAL/ThreadSafeCounter.h"
+#include "HAL/ThreadSafeCounter64.h"
+#include "Containers/Queue.h"
+
+struct ImGuiContext;
+
+/*
+ * Asynchronous backend for ImGui's LogToFile and LogToTTY. The capture goes to ImGui's in-memory log
+ * buffer instead of a FILE, and the captured text is handed over in chunks to a writer thread, which
+ * appends it to the file (or stdout) like ImGui does. The frame never waits for the disk: when more
+ * than MaxPendingBytes wait for the writer, new chunks are dropped (and counted).
+ *
+ * One capture per ImGui context, game thread only except for the writer itself.
+ */
+class IMGUI_API FImGuiAsyncLog : public FRunnable
+{
+public:
+
+	static FImGuiAsyncLog& Get();
+
+	virtual ~FImGuiAsyncLog();
+
+	// Starts capturing the log of the current context, to #Filename (io.LogFilename if empty).
+	void LogToFile(const FString& Filename, int32 AutoOpenDepth = -1);
+
+	void LogToTTY(int32 AutoOpenDepth = -1);
+
+	// Hands the text captured so far to the writer, for captures spanning several frames.
+	void Flush();
+
+	// Ends the capture of the current context. Other kinds of capture go to ImGui::LogFinish.
+	void LogFinish();
+
+	bool IsCapturing() const;
+
+	// Waits for the writer to finish. Only this waits for the disk.
+	void Stop();
+
+	int64 GetWrittenBytes() const { return WrittenBytes.GetValue(); }
+	int64 GetPendingBytes() const { return PendingBytes.GetValue(); }
+	int32 GetDroppedChunks() const { return DroppedChunks.GetValue(); }
+
+	// FRunnable
+	virtual uint32 Run() override;
+
+	// Text kept in memory before the writer catches up.
+	static constexpr int64 MaxPendingBytes = 64 * 1024 * 1024;
+
+private:
+
+	FImGuiAsyncLog();
+
+	struct FJob
+	{
+		FString Filename;
+		TArray<ANSICHAR> Text;
+		bool bClose = false;
+	};
+
+	void Begin(const FString& Filename, int32 AutoOpenDepth);
+	void Submit(const FString& Filename, bool bClose);
+	void Write(TMap<FString, TUniquePtr<FArchive>>& Files, FJob& Job);
+
+	// target file of the capture of each context, empty for stdout
+	TMap<ImGuiContext*, FString> Captures;
+
+	TQueue<TUniquePtr<FJob>, EQueueMode::Spsc> Jobs;
+	FEvent* WorkEvent = nullptr;
+	FRunnableThread* Thread = nullptr;
+	FDelegateHandle PreExitHandle;
+	FThreadSafeBool bStopping;
+
+	FThreadSafeCounter64 PendingBytes;
+	FThreadSafeCounter64 WrittenBytes;
+	FThreadSafeCounter DroppedChunks;
+};
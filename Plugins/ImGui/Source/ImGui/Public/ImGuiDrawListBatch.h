@@ -0,0 +1,105 @@
+// Distributed under the MIT License (MIT) (see accompanying LICENSE file)
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Kismet/BlueprintFunctionLibrary.h"
+#include <imgui.h>
+
+#include "ImGuiDrawListBatch.generated.h"
+
+UENUM(BlueprintType)
+enum class EImGuiDrawList : uint8
+{
+	Window,     // current window, clipped to it
+	Background, // behind all windows
+	Foreground  // over all windows
+};
+
+/*
+ * Batch primitives for ImDrawList. Every call reserves the vertices and indices of the whole batch
+ * with one PrimReserve and writes them in place, instead of one path per primitive. With 16 bit
+ * indices a batch is split every 64K vertices. All coordinates are in screen space.
+ * #Colors holds one color per item, or a single color for all of them.
+ */
+class IMGUI_API FImGuiDrawListBatch
+{
+public:
+
+	static ImDrawList* GetDrawList(EImGuiDrawList Target);
+
+	static ImU32 ToColorU32(const FLinearColor& Color)
+	{
+		return ImGui::ColorConvertFloat4ToU32(ImVec4(Color.R, Color.G, Color.B, Color.A));
+	}
+
+	static TArray<ImU32, TInlineAllocator<64>> ToColorsU32(const TArray<FLinearColor>& Colors)
+	{
+		TArray<ImU32, TInlineAllocator<64>> Result;
+		Result.SetNumUninitialized(Colors.Num());
+		for (int32 i = 0; i < Colors.Num(); ++i)
+		{
+			Result[i] = ToColorU32(Colors[i]);
+		}
+		return Result;
+	}
+
+	static void AddPolyline(ImDrawList* DrawList, const FVector2D* Points, int32 Count, ImU32 Color, bool bClosed, float Thickness);
+	static void AddConvexPolyFilled(ImDrawList* DrawList, const FVector2D* Points, int32 Count, ImU32 Color);
+
+	// Line i goes from Points[2 * i] to Points[2 * i + 1].
+	static void AddLines(ImDrawList* DrawList, const FVector2D* Points, int32 NumLines, const ImU32* Colors, int32 NumColors, float Thickness);
+
+	// Rect i spans Corners[2 * i] (min) to Corners[2 * i + 1] (max).
+	static void AddRects(ImDrawList* DrawList, const FVector2D* Corners, int32 NumRects, const ImU32* Colors, int32 NumColors, float Thickness, bool bFilled);
+
+	// #Radii holds one radius per circle or a single one for all. #NumSegments <= 0 picks it from the largest radius.
+	static void AddCircles(ImDrawList* DrawList, const FVector2D* Centers, int32 NumCircles, const float* Radii, int32 NumRadii, const ImU32* Colors, int32 NumColors, float Thickness, bool bFilled, int32 NumSegments = 0);
+};
+
+/*
+ *
+ */
+UCLASS()
+class IMGUI_API UImGuiDrawListFunction : public UBlueprintFunctionLibrary
+{
+	GENERATED_BODY()
+
+public:
+
+	UFUNCTION(BlueprintCallable, Category = "ImGui|DrawList", meta = (AdvancedDisplay = "3"))
+	static void DrawPolyline(EImGuiDrawList target, const TArray<FVector2D>& points, FLinearColor color, float thickness = 1.0f, bool closed = false)
+	{
+		FImGuiDrawListBatch::AddPolyline(FImGuiDrawListBatch::GetDrawList(target), points.GetData(), points.Num(), FImGuiDrawListBatch::ToColorU32(color), closed, thickness);
+	}
+
+	UFUNCTION(BlueprintCallable, Category = "ImGui|DrawList")
+	static void DrawConvexPolyFilled(EImGuiDrawList target, const TArray<FVector2D>& points, FLinearColor color)
+	{
+		FImGuiDrawListBatch::AddConvexPolyFilled(FImGuiDrawListBatch::GetDrawList(target), points.GetData(), points.Num(), FImGuiDrawListBatch::ToColorU32(color));
+	}
+
+	// Draws points.Num() / 2 lines, from points[2 * i] to points[2 * i + 1]. #colors holds one color per line or a single one.
+	UFUNCTION(BlueprintCallable, Category = "ImGui|DrawList", meta = (AdvancedDisplay = "3"))
+	static void DrawLines(EImGuiDrawList target, const TArray<FVector2D>& points, const TArray<FLinearColor>& colors, float thickness = 1.0f)
+	{
+		const TArray<ImU32, TInlineAllocator<64>> Colors = FImGuiDrawListBatch::ToColorsU32(colors);
+		FImGuiDrawListBatch::AddLines(FImGuiDrawListBatch::GetDrawList(target), points.GetData(), points.Num() / 2, Colors.GetData(), Colors.Num(), thickness);
+	}
+
+	// Draws corners.Num() / 2 rects, from corners[2 * i] (min) to corners[2 * i + 1] (max). #colors holds one color per rect or a single one.
+	UFUNCTION(BlueprintCallable, Category = "ImGui|DrawList", meta = (AdvancedDisplay = "3"))
+	static void DrawRects(EImGuiDrawList target, const TArray<FVector2D>& corners, const TArray<FLinearColor>& colors, float thickness = 1.0f, bool filled = false)
+	{
+		const TArray<ImU32, TInlineAllocator<64>> Colors = FImGuiDrawListBatch::ToColorsU32(colors);
+		FImGuiDrawListBatch::AddRects(FImGuiDrawListBatch::GetDrawList(target), corners.GetData(), corners.Num() / 2, Colors.GetData(), Colors.Num(), thickness, filled);
+	}
+
+	// #radii and #colors hold one entry per circle or a single one. #num_segments <= 0 picks it from the largest radius.
+	UFUNCTION(BlueprintCallable, Category = "ImGui|DrawList", meta = (AdvancedDisplay = "4"))
+	static void DrawCircles(EImGuiDrawList target, const TArray<FVector2D>& centers, const TArray<float>& radii, const TArray<FLinearColor>& colors, float thickness = 1.0f, bool filled = false, int32 num_segments = 0)
+	{
+		const TArray<ImU32, TInlineAllocator<64>> Colors = FImGuiDrawListBatch::ToColorsU32(colors);
+		FImGuiDrawListBatch::AddCircles(FImGuiDrawListBatch::GetDrawList(target), centers.GetData(), centers.Num(), radii.GetData(), radii.Num(), Colors.GetData(), Colors.Num(), thickness, filled, num_segments);
+	}
+};
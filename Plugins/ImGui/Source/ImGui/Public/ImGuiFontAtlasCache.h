@@ -0,0 +1,32 @@
+// Distributed under the MIT License (MIT) (see accompanying LICENSE file)
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include <imgui.h>
+
+/*
+ * Disk cache for built font atlases. The atlas pixels (alpha 8), glyph tables and custom rects are
+ * saved to Saved/ImGui/ under a key hashed from everything that affects rasterization: font data,
+ * sizes, glyph ranges, oversampling and atlas settings. A later build with the same sources maps
+ * that file and fills the atlas from it instead of rasterizing.
+ *
+ * Use Build in place of ImFontAtlas::Build, after the fonts were added and before the texture data
+ * is read (GetTexDataAsAlpha8 / GetTexDataAsRGBA32 return the cached pixels).
+ */
+class IMGUI_API FImGuiFontAtlasCache
+{
+public:
+
+	// Fills #Atlas from the cache, or builds it and saves the result. Returns false if the build failed.
+	static bool Build(ImFontAtlas* Atlas);
+
+	static uint64 ComputeKey(const ImFontAtlas* Atlas);
+	static FString GetCacheFilename(uint64 Key);
+
+	// Fills an atlas that was not built yet from the file of #Key. Returns false if there is no valid file.
+	static bool Load(ImFontAtlas* Atlas, uint64 Key);
+
+	// Saves a built #Atlas in the background and deletes the files of other keys.
+	static void Save(const ImFontAtlas* Atlas, uint64 Key);
+};
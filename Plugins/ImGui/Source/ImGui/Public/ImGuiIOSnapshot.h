@@ -0,0 +1,139 @@
+// Distributed under the MIT License (MIT) (see accompanying LICENSE file)
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Kismet/BlueprintFunctionLibrary.h"
+#include "ImGuiInteroperability.h"
+
+#include "ImGuiIOSnapshot.generated.h"
+
+/*
+ * Input and IO state of the current ImGui frame, read from ImGuiIO in one go. Keys are kept as
+ * bitsets (ImGui key index, see GetKeyIndex) read through the functions below, mouse buttons as bit
+ * masks (bit n is button n).
+ */
+USTRUCT(BlueprintType)
+struct IMGUI_API FImGuiIOSnapshot
+{
+	GENERATED_BODY()
+
+	static constexpr int32 NumKeys = 512;
+	static constexpr int32 NumKeyWords = NumKeys / 32;
+
+	UPROPERTY(BlueprintReadOnly, Category = "ImGui|Input")
+	int32 FrameCount = -1;
+
+	UPROPERTY(BlueprintReadOnly, Category = "ImGui|Input")
+	float DeltaTime = 0.0f;
+
+	UPROPERTY(BlueprintReadOnly, Category = "ImGui|Input")
+	FVector2D DisplaySize = FVector2D::ZeroVector;
+
+	UPROPERTY(BlueprintReadOnly, Category = "ImGui|Input")
+	FVector2D MousePos = FVector2D::ZeroVector;
+
+	UPROPERTY(BlueprintReadOnly, Category = "ImGui|Input")
+	FVector2D MouseDelta = FVector2D::ZeroVector;
+
+	UPROPERTY(BlueprintReadOnly, Category = "ImGui|Input")
+	float MouseWheel = 0.0f;
+
+	UPROPERTY(BlueprintReadOnly, Category = "ImGui|Input")
+	float MouseWheelH = 0.0f;
+
+	// Mouse button masks, bit n for button n.
+	UPROPERTY(BlueprintReadOnly, Category = "ImGui|Input")
+	int32 MouseDown = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "ImGui|Input")
+	int32 MouseClicked = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "ImGui|Input")
+	int32 MouseDoubleClicked = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "ImGui|Input")
+	int32 MouseReleased = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "ImGui|Input")
+	bool bKeyCtrl = false;
+
+	UPROPERTY(BlueprintReadOnly, Category = "ImGui|Input")
+	bool bKeyShift = false;
+
+	UPROPERTY(BlueprintReadOnly, Category = "ImGui|Input")
+	bool bKeyAlt = false;
+
+	UPROPERTY(BlueprintReadOnly, Category = "ImGui|Input")
+	bool bKeySuper = false;
+
+	UPROPERTY(BlueprintReadOnly, Category = "ImGui|Input")
+	bool bWantCaptureMouse = false;
+
+	UPROPERTY(BlueprintReadOnly, Category = "ImGui|Input")
+	bool bWantCaptureKeyboard = false;
+
+	UPROPERTY(BlueprintReadOnly, Category = "ImGui|Input")
+	bool bWantTextInput = false;
+
+	// key bitsets, by ImGui key index
+	uint32 KeysDown[NumKeyWords] = {};
+	uint32 KeysPressed[NumKeyWords] = {};
+	uint32 KeysReleased[NumKeyWords] = {};
+
+	static bool TestBit(const uint32* Bits, int32 Key)
+	{
+		return Key >= 0 && Key < NumKeys && (Bits[Key >> 5] & (1u << (Key & 31))) != 0;
+	}
+
+	// Snapshot of the current context, filled once per ImGui frame and shared by the calls of that frame.
+	static const FImGuiIOSnapshot& Get();
+
+	void Fill();
+};
+
+/*
+ *
+ */
+UCLASS()
+class IMGUI_API UImGuiIOSnapshotFunction : public UBlueprintFunctionLibrary
+{
+	GENERATED_BODY()
+
+public:
+
+	// Input and IO state of the current frame. Not pure, so it is read once however many pins use it.
+	UFUNCTION(BlueprintCallable, Category = "ImGui|Input")
+	static void GetIOSnapshot(FImGuiIOSnapshot& snapshot) { snapshot = FImGuiIOSnapshot::Get(); }
+
+	UFUNCTION(BlueprintPure, Category = "ImGui|Input")
+	static bool SnapshotIsKeyDown(const FImGuiIOSnapshot& snapshot, int32 key_index) { return FImGuiIOSnapshot::TestBit(snapshot.KeysDown, key_index); }
+
+	UFUNCTION(BlueprintPure, Category = "ImGui|Input")
+	static bool SnapshotIsKeyPressed(const FImGuiIOSnapshot& snapshot, int32 key_index) { return FImGuiIOSnapshot::TestBit(snapshot.KeysPressed, key_index); }
+
+	UFUNCTION(BlueprintPure, Category = "ImGui|Input")
+	static bool SnapshotIsKeyReleased(const FImGuiIOSnapshot& snapshot, int32 key_index) { return FImGuiIOSnapshot::TestBit(snapshot.KeysReleased, key_index); }
+
+	// Same as SnapshotIsKeyDown, for an engine key.
+	UFUNCTION(BlueprintPure, Category = "ImGui|Input")
+	static bool SnapshotIsEngineKeyDown(const FImGuiIOSnapshot& snapshot, const FKey& key) { return FImGuiIOSnapshot::TestBit(snapshot.KeysDown, ImGuiInterops::GetKeyIndex(key)); }
+
+	UFUNCTION(BlueprintPure, Category = "ImGui|Input")
+	static bool SnapshotIsEngineKeyPressed(const FImGuiIOSnapshot& snapshot, const FKey& key) { return FImGuiIOSnapshot::TestBit(snapshot.KeysPressed, ImGuiInterops::GetKeyIndex(key)); }
+
+	UFUNCTION(BlueprintPure, Category = "ImGui|Input")
+	static bool SnapshotIsEngineKeyReleased(const FImGuiIOSnapshot& snapshot, const FKey& key) { return FImGuiIOSnapshot::TestBit(snapshot.KeysReleased, ImGuiInterops::GetKeyIndex(key)); }
+
+	UFUNCTION(BlueprintPure, Category = "ImGui|Input")
+	static bool SnapshotIsMouseDown(const FImGuiIOSnapshot& snapshot, int32 button) { return button >= 0 && button < 32 && (snapshot.MouseDown & (1 << button)) != 0; }
+
+	UFUNCTION(BlueprintPure, Category = "ImGui|Input")
+	static bool SnapshotIsMouseClicked(const FImGuiIOSnapshot& snapshot, int32 button, bool double_click = false)
+	{
+		return button >= 0 && button < 32 && ((double_click ? snapshot.MouseDoubleClicked : snapshot.MouseClicked) & (1 << button)) != 0;
+	}
+
+	UFUNCTION(BlueprintPure, Category = "ImGui|Input")
+	static bool SnapshotIsMouseReleased(const FImGuiIOSnapshot& snapshot, int32 button) { return button >= 0 && button < 32 && (snapshot.MouseReleased & (1 << button)) != 0; }
+};
@@ -0,0 +1,74 @@
+// Distributed under the MIT License (MIT) (see accompanying LICENSE file)
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Kismet/BlueprintFunctionLibrary.h"
+
+#include "ImGuiIniPersistence.generated.h"
+
+/*
+ * Takes saving the .ini settings over from ImGui, which writes the file on the game thread. Once
+ * enabled, each context's io.IniFilename is cleared, so ImGui only raises io.WantSaveIniSettings;
+ * the settings are then snapshotted to memory on the game thread and written by a background task
+ * when no change happened for the debounce time (or the first change is MaxDelaySeconds old). Files
+ * are written next to the target and renamed, an unchanged snapshot is not written again.
+ *
+ * Loading is left to ImGui, the first NewFrame of a context reads its file before we take it over.
+ * Pending settings are written when a world is cleaned up and before exit.
+ */
+class IMGUI_API FImGuiIniPersistence
+{
+public:
+
+	static void Enable(float DebounceSeconds = 1.0f, float MaxDelaySeconds = 10.0f);
+
+	// Writes the pending settings and gives saving back to ImGui, context by context on their next frame.
+	static void Disable();
+
+	static bool IsEnabled();
+
+	// Takes over the current context and snapshots or writes its settings when due. Called for every context each frame once enabled.
+	static void Update();
+
+	// Starts the pending writes now. With #bWait, also waits for all writes to finish.
+	static void Flush(bool bWait = false);
+
+	// Writes the settings of the current context to #Filename on a background task.
+	static void SaveAsync(const FString& Filename);
+
+	// Writes #Data through a temp file and a rename, so a reader never sees a partial file. Any thread.
+	static bool WriteFile(const FString& Filename, const TArray<ANSICHAR>& Data);
+
+	// io.IniSavingRate while enabled: how often a change in progress (a window drag) is snapshotted.
+	static constexpr float SnapshotInterval = 0.25f;
+};
+
+/*
+ *
+ */
+UCLASS()
+class IMGUI_API UImGuiIniPersistenceFunction : public UBlueprintFunctionLibrary
+{
+	GENERATED_BODY()
+
+public:
+
+	// Moves .ini saving of all contexts to a background task. Changes are written #debounce_seconds after the last one.
+	UFUNCTION(BlueprintCallable, Category = "ImGui|Utilities|Settings", meta = (AdvancedDisplay = "1"))
+	static void EnableAsyncIniSettings(float debounce_seconds = 1.0f, float max_delay_seconds = 10.0f)
+	{
+		FImGuiIniPersistence::Enable(debounce_seconds, max_delay_seconds);
+	}
+
+	UFUNCTION(BlueprintCallable, Category = "ImGui|Utilities|Settings")
+	static void DisableAsyncIniSettings() { FImGuiIniPersistence::Disable(); }
+
+	// Starts writing the pending settings now, without waiting for the debounce.
+	UFUNCTION(BlueprintCallable, Category = "ImGui|Utilities|Settings")
+	static void FlushIniSettings() { FImGuiIniPersistence::Flush(); }
+
+	// Like SaveIniSettingsToDisk, with the file written on a background task.
+	UFUNCTION(BlueprintCallable, Category = "ImGui|Utilities|Settings")
+	static void SaveIniSettingsToDiskAsync(const FString& ini_filename) { FImGuiIniPersistence::SaveAsync(ini_filename); }
+};
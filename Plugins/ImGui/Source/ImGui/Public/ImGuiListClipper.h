@@ -0,0 +1,118 @@
+// Distributed under the MIT License (MIT) (see accompanying LICENSE file)
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Kismet/BlueprintFunctionLibrary.h"
+#include <imgui.h>
+
+#include "ImGuiListClipper.generated.h"
+
+// Asked for the rows in [display_start, display_end) that are on screen.
+DECLARE_DYNAMIC_DELEGATE_TwoParams(FImGuiVisibleRowsDelegate, int32, display_start, int32, display_end);
+
+// Asked to submit row #row, which is on screen.
+DECLARE_DYNAMIC_DELEGATE_OneParam(FImGuiVisibleRowDelegate, int32, row);
+
+// Blueprint handle to an ImGuiListClipper. Copies of the struct share the same clipper.
+USTRUCT(BlueprintType)
+struct FImGuiListClipperHandle
+{
+	GENERATED_BODY()
+
+	TSharedPtr<ImGuiListClipper> Clipper;
+
+	bool IsValid() const { return Clipper.IsValid(); }
+};
+
+/*
+ * Virtualized lists and tables. Only the rows inside the visible part of the current window (or
+ * table) are submitted, the clipper advances the cursor over the others, so the cost of a frame
+ * follows the height of the view instead of the number of rows.
+ * #row_height <= 0 measures the height from the first row.
+ */
+UCLASS()
+class IMGUI_API UImGuiListClipperFunction : public UBlueprintFunctionLibrary
+{
+	GENERATED_BODY()
+
+public:
+
+	// Starts a clipper over #row_count rows. Call ListClipperStep until it returns false.
+	UFUNCTION(BlueprintCallable, Category = "ImGui|Clipper", meta = (AdvancedDisplay = "1"))
+	static FImGuiListClipperHandle ListClipperBegin(int32 row_count, float row_height = -1.0f)
+	{
+		FImGuiListClipperHandle Handle;
+		// a clipper dropped before the end must not assert, ImGui state is not touched outside the frame
+		Handle.Clipper = MakeShareable(new ImGuiListClipper(), [](ImGuiListClipper* Clipper)
+		{
+			Clipper->ItemsCount = -1;
+			delete Clipper;
+		});
+		Handle.Clipper->Begin(FMath::Max(0, row_count), row_height);
+		return Handle;
+	}
+
+	// Gives the next range of rows to submit, [display_start, display_end). Returns false (and ends the clipper) when done.
+	UFUNCTION(BlueprintCallable, Category = "ImGui|Clipper")
+	static bool ListClipperStep(UPARAM(ref) FImGuiListClipperHandle& clipper, int32& display_start, int32& display_end)
+	{
+		display_start = display_end = 0;
+		if (!clipper.IsValid() || !clipper.Clipper->Step())
+			return false;
+
+		display_start = clipper.Clipper->DisplayStart;
+		display_end = clipper.Clipper->DisplayEnd;
+		return true;
+	}
+
+	// Ends a clipper early. Not needed once ListClipperStep returned false.
+	UFUNCTION(BlueprintCallable, Category = "ImGui|Clipper")
+	static void ListClipperEnd(UPARAM(ref) FImGuiListClipperHandle& clipper)
+	{
+		if (clipper.IsValid())
+		{
+			clipper.Clipper->End();
+		}
+		clipper.Clipper.Reset();
+	}
+
+	// Calls #draw_rows once per visible range of the #row_count rows. Without a #row_height, the height is measured on the
+	// first row, so drawing it must move the cursor down (submit at least one item), or ImGui asserts.
+	UFUNCTION(BlueprintCallable, Category = "ImGui|Clipper", meta = (AdvancedDisplay = "2"))
+	static void DrawClippedRows(int32 row_count, const FImGuiVisibleRowsDelegate& draw_rows, float row_height = -1.0f)
+	{
+		if (row_count <= 0 || !draw_rows.IsBound())
+			return;
+
+		ImGuiListClipper Clipper;
+		Clipper.Begin(row_count, row_height);
+		while (Clipper.Step())
+		{
+			draw_rows.Execute(Clipper.DisplayStart, Clipper.DisplayEnd);
+		}
+	}
+
+	// Calls #draw_row for each visible row of the #row_count rows. With #table_rows a table row is started before each call.
+	// Without a #row_height, the first row must move the cursor down, as for DrawClippedRows.
+	UFUNCTION(BlueprintCallable, Category = "ImGui|Clipper", meta = (AdvancedDisplay = "2"))
+	static void DrawClippedRowsEach(int32 row_count, const FImGuiVisibleRowDelegate& draw_row, float row_height = -1.0f, bool table_rows = false)
+	{
+		if (row_count <= 0 || !draw_row.IsBound())
+			return;
+
+		ImGuiListClipper Clipper;
+		Clipper.Begin(row_count, row_height);
+		while (Clipper.Step())
+		{
+			for (int32 Row = Clipper.DisplayStart; Row < Clipper.DisplayEnd; ++Row)
+			{
+				if (table_rows)
+				{
+					ImGui::TableNextRow(0, FMath::Max(0.0f, row_height));
+				}
+				draw_row.Execute(Row);
+			}
+		}
+	}
+};
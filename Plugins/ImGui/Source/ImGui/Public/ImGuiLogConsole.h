@@ -0,0 +1,166 @@
+// Distributed under the MIT License (MIT) (see accompanying LICENSE file)
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/ActorComponent.h"
+#include "Misc/OutputDevice.h"
+#include "Templates/Atomic.h"
+
+#include "ImGuiLogConsole.generated.h"
+
+struct FImGuiLogLine
+{
+	FName Category;
+	double Time = 0.0;
+	ELogVerbosity::Type Verbosity = ELogVerbosity::Log;
+	bool bTruncated = false;
+	TArray<ANSICHAR, TInlineAllocator<256>> Text; // UTF-8, null terminated
+};
+
+/*
+ * Captures UE_LOG output from any thread into a ring of fixed size segments, without locks. A writer
+ * takes a line number with an atomic increment, reserves its text in the segment of that line with a
+ * compare-exchange, then publishes the line by stamping its slot. Categories are stored as FName,
+ * which the engine already interns.
+ *
+ * Readers copy a line and check the stamp and the segment generation afterwards, a line overwritten
+ * meanwhile is reported as missing. Lines older than the ring are lost, nothing ever waits.
+ *
+ * The text area of a segment allows 256 bytes per line on average. A line longer than MaxLineBytes,
+ * or one that does not fit in what is left of its segment's text, is cut and marked as truncated.
+ */
+class IMGUI_API FImGuiLogCapture : public FOutputDevice
+{
+public:
+
+	// The capture is created and registered with GLog on first use, and removed from it before exit or on module unload.
+	static FImGuiLogCapture& Get();
+
+	// Number of lines logged so far, the next line number.
+	uint64 GetHead() const { return Head.Load(); }
+
+	// First line number that can still be read, for #InHead.
+	static uint64 GetFirst(uint64 InHead);
+
+	// Copies line #Line. Returns false if it is not published yet or was overwritten.
+	bool Read(uint64 Line, FImGuiLogLine& Out) const;
+
+	// FOutputDevice
+	virtual void Serialize(const TCHAR* V, ELogVerbosity::Type Verbosity, const FName& Category) override;
+	virtual void Serialize(const TCHAR* V, ELogVerbosity::Type Verbosity, const FName& Category, const double Time) override;
+	virtual bool CanBeUsedOnAnyThread() const override { return true; }
+
+	static constexpr int32 SegmentLines = 4096;
+	static constexpr int32 SegmentBytes = 1024 * 1024;
+	static constexpr int32 NumSegments = 32;
+	static constexpr int32 MaxLineBytes = 2048;
+
+private:
+
+	FImGuiLogCapture();
+
+	struct FSlot
+	{
+		TAtomic<uint64> Stamp; // line number + 1 once published
+		FName Category;
+		double Time;
+		uint32 TextOffset;
+		uint32 TextLength;
+		uint8 Verbosity;
+		bool bTruncated;
+	};
+
+	struct FSegment
+	{
+		FSlot Slots[SegmentLines];
+		TAtomic<uint64> TextCursor; // generation << 32 | bytes used
+		ANSICHAR Text[SegmentBytes];
+	};
+
+	void Write(const ANSICHAR* Text, int32 Length, ELogVerbosity::Type Verbosity, const FName& Category, double Time);
+
+	TUniquePtr<FSegment[]> Segments;
+	TAtomic<uint64> Head;
+};
+
+/*
+ * Log console over the capture. Each Update reads the new lines once, tests them against the filter
+ * (text, verbosity, category) and appends the matching line numbers to the filter index, so the index
+ * is only rebuilt when the filter changes, and only from the previous matches when the new filter is
+ * narrower. The window draws the visible rows of the index through a list clipper.
+ */
+class IMGUI_API FImGuiLogConsole
+{
+public:
+
+	FImGuiLogConsole();
+
+	// Reads the lines logged since the last call.
+	void Update();
+
+	void Draw(const char* WindowName, bool* bOpen = nullptr);
+
+	// #Text is matched case insensitive, a None #Category matches all categories.
+	void SetFilter(const FString& Text, ELogVerbosity::Type MaxVerbosity = ELogVerbosity::All, FName Category = NAME_None);
+
+	// Hides the lines logged so far.
+	void Clear();
+
+	int32 NumMatches() const { return Matches.Num() - MatchesBegin; }
+
+	// Lines overwritten before this console read them.
+	uint64 GetLostLines() const { return LostLines; }
+
+private:
+
+	bool PassesFilter(const FImGuiLogLine& Line) const;
+	void Refilter(bool bNarrow);
+	void DrawToolbar();
+	void DrawLine(uint64 Line);
+
+	uint64 ReadLine = 0;
+	uint64 ClearLine = 0;
+	uint64 LostLines = 0;
+
+	// filter index, matching line numbers in ascending order from MatchesBegin
+	TArray<uint64> Matches;
+	int32 MatchesBegin = 0;
+
+	TArray<ANSICHAR> Query; // UTF-8, null terminated
+	ELogVerbosity::Type MaxVerbosity = ELogVerbosity::All;
+	FName Category;
+
+	TMap<FName, TArray<ANSICHAR>> CategoryNames;
+	char FilterText[256] = {};
+	bool bAutoScroll = true;
+
+	FImGuiLogLine Scratch;
+};
+
+// Drop-in debug component drawing the log console, next to UImGuiComponent.
+UCLASS(Blueprintable, meta=(BlueprintSpawnableComponent))
+class IMGUI_API UImGuiLogConsoleComponent : public UActorComponent
+{
+	GENERATED_BODY()
+
+public:
+
+	UImGuiLogConsoleComponent();
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ImGui|Log")
+	FString WindowName = TEXT("Log");
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ImGui|Log")
+	bool bOpen = true;
+
+protected:
+
+	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
+	void ImGuiTick();
+
+	FDelegateHandle ImGuiTickHandle;
+	TUniquePtr<FImGuiLogConsole> Console;
+};
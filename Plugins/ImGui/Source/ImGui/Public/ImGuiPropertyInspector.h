@@ -0,0 +1,69 @@
+// Distributed under the MIT License (MIT) (see accompanying LICENSE file)
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Kismet/BlueprintFunctionLibrary.h"
+
+#include "ImGuiPropertyInspector.generated.h"
+
+/*
+ * Property inspector for any UObject or UStruct instance. The first time a class or struct is seen,
+ * its properties are compiled into a flat list of visitors (offset, kind, widget data, labels), which
+ * later frames walk without reflection casts. Arrays, sets and maps show their elements under a tree
+ * node, nested structs and objects expand in place. Rows outside the window are skipped, large
+ * arrays of simple values go through a list clipper.
+ *
+ * Edits write the value in place, set elements and map keys are shown read only.
+ */
+class IMGUI_API FImGuiPropertyInspector
+{
+public:
+
+	// Draws the properties of #Container, an instance of #Struct (a UClass or UScriptStruct). Returns true if a value was edited.
+	static bool Draw(const UStruct* Struct, void* Container, bool bEditable = true);
+
+	static bool DrawObject(UObject* Object, bool bEditable = true);
+
+	// Drops the compiled layouts. Layouts of recompiled classes and structs are also rebuilt on their own.
+	static void Reset();
+
+	// Objects and structs nested deeper than this are not expanded.
+	static constexpr int32 MaxDepth = 16;
+};
+
+/*
+ *
+ */
+UCLASS()
+class IMGUI_API UImGuiPropertyInspectorFunction : public UBlueprintFunctionLibrary
+{
+	GENERATED_BODY()
+
+public:
+
+	// Draws the properties of #object. Returns true if a value was edited.
+	UFUNCTION(BlueprintCallable, Category = "ImGui|Inspector")
+	static bool InspectObject(UObject* object, bool editable = true)
+	{
+		return FImGuiPropertyInspector::DrawObject(object, editable);
+	}
+
+	// Draws the properties of the struct #value. Returns true if a value was edited.
+	UFUNCTION(BlueprintCallable, CustomThunk, Category = "ImGui|Inspector", meta = (CustomStructureParam = "value"))
+	static bool InspectStruct(UPARAM(ref) int32& value, bool editable = true);
+
+	DECLARE_FUNCTION(execInspectStruct)
+	{
+		Stack.MostRecentProperty = nullptr;
+		Stack.StepCompiledIn<FStructProperty>(nullptr);
+		void* StructAddr = Stack.MostRecentPropertyAddress;
+		FStructProperty* StructProperty = CastField<FStructProperty>(Stack.MostRecentProperty);
+		P_GET_UBOOL(editable);
+		P_FINISH;
+
+		P_NATIVE_BEGIN;
+		*(bool*)RESULT_PARAM = StructProperty && StructAddr ? FImGuiPropertyInspector::Draw(StructProperty->Struct, StructAddr, editable) : false;
+		P_NATIVE_END;
+	}
+};
@@ -0,0 +1,85 @@
+// Distributed under the MIT License (MIT) (see accompanying LICENSE file)
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Kismet/BlueprintFunctionLibrary.h"
+#include <imgui.h>
+
+#include "ImGuiRetainedWindow.generated.h"
+
+UENUM(BlueprintType)
+enum class EImGuiRetainedWindowResult : uint8
+{
+	Rebuild,  // submit the content, then call EndRetained
+	Replayed, // previous content was copied, only call EndRetained
+	Closed    // collapsed or closed, nothing to end
+};
+
+/*
+ * Opt-in retained mode for a window. The content submitted between Begin and End is copied out of
+ * the window draw list (commands, vertices and indices). On the next frames, while the inputs hash
+ * is the same and nothing marks the window dirty, Begin appends that copy again instead of letting
+ * the caller run the widget code, moving it by how much the window moved.
+ *
+ * The window is rebuilt when it is resized, scrolled, hovered, holds the active item or keyboard
+ * navigation, or is the source of an open popup, since its widgets have to run to react to input.
+ * Content with child windows or user callbacks is never replayed (they are not in the copied range).
+ * Copies are kept per ImGui context, so a window of the same name in another world is separate.
+ */
+class IMGUI_API FImGuiRetainedWindow
+{
+public:
+
+	// Begins the window. On Rebuild and Replayed End must be called, on Closed it must not.
+	// #MaxReplayFrames > 0 forces a rebuild after that many replayed frames.
+	static EImGuiRetainedWindowResult Begin(const char* Name, bool* bOpen, ImGuiWindowFlags Flags, uint32 InputsHash, bool bDirty, int32 MaxReplayFrames = 0);
+	static void End();
+
+	// Drops the copy of window #Name in the current context, so that it is rebuilt next frame.
+	static void Invalidate(const char* Name);
+	static void Reset();
+
+	// Copies not used for this many frames are released.
+	static constexpr uint64 MaxUnusedFrames = 300;
+};
+
+/*
+ *
+ */
+UCLASS()
+class IMGUI_API UImGuiRetainedWindowFunction : public UBlueprintFunctionLibrary
+{
+	GENERATED_BODY()
+
+public:
+
+	// Begins a window whose content is replayed while #inputs_hash is unchanged and #dirty is false.
+	// Submit the content and call EndRetained on Rebuild, only call EndRetained on Replayed.
+	UFUNCTION(BlueprintCallable, Category = "ImGui|Windows", meta = (ExpandEnumAsExecs = "OutResult", AdvancedDisplay = "5"))
+	static void BeginRetained(const FString& name, UPARAM(ref) bool& open, int32 inputs_hash, bool dirty, EImGuiRetainedWindowResult& OutResult,
+		UPARAM(meta = (Bitmask, BitmaskEnum = EImGuiWindowFlags)) int32 ImGuiWindowFlags = 0, int32 max_replay_frames = 0)
+	{
+		OutResult = EImGuiRetainedWindowResult::Closed;
+		if (open)
+		{
+			OutResult = FImGuiRetainedWindow::Begin(TCHAR_TO_ANSI(*name), &open, ImGuiWindowFlags, (uint32)inputs_hash, dirty, max_replay_frames);
+		}
+	}
+
+	UFUNCTION(BlueprintCallable, Category = "ImGui|Windows")
+	static void EndRetained() { FImGuiRetainedWindow::End(); }
+
+	UFUNCTION(BlueprintCallable, Category = "ImGui|Windows")
+	static void InvalidateRetained(const FString& name) { FImGuiRetainedWindow::Invalidate(TCHAR_TO_ANSI(*name)); }
+
+	// Hash helpers to build #inputs_hash from the values the window content depends on.
+	UFUNCTION(BlueprintPure, Category = "ImGui|Windows")
+	static int32 HashCombineInt(int32 hash, int32 value) { return (int32)HashCombine((uint32)hash, GetTypeHash(value)); }
+
+	UFUNCTION(BlueprintPure, Category = "ImGui|Windows")
+	static int32 HashCombineFloat(int32 hash, float value) { return (int32)HashCombine((uint32)hash, GetTypeHash(value)); }
+
+	UFUNCTION(BlueprintPure, Category = "ImGui|Windows")
+	static int32 HashCombineString(int32 hash, const FString& value) { return (int32)HashCombine((uint32)hash, GetTypeHash(value)); }
+};
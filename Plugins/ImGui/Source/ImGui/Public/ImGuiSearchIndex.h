@@ -0,0 +1,158 @@
+// Distributed under the MIT License (MIT) (see accompanying LICENSE file)
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Kismet/BlueprintFunctionLibrary.h"
+
+#include "ImGuiSearchIndex.generated.h"
+
+/*
+ * Case insensitive substring search over a list of rows, for filter boxes over large lists. Rows
+ * are indexed by trigram and the index is updated row by row as the data changes. A query looks up
+ * the smallest trigram posting list and only tests those rows; a query that extends the previous
+ * one only re-tests the previous matches. Queries shorter than 3 characters scan the rows.
+ *
+ * Changed rows leave stale postings behind, which lookups skip by generation, and which are dropped
+ * when they make up half of the index.
+ */
+class IMGUI_API FImGuiSearchIndex
+{
+public:
+
+	int32 Num() const { return Texts.Num(); }
+
+	int32 AddRow(const FString& Text);
+	void SetRow(int32 Row, const FString& Text);
+
+	// Keeps the row index of the other rows, the row just stops matching.
+	void RemoveRow(int32 Row);
+
+	// Updates the index to #Rows, only re-indexing rows whose text changed.
+	void SetRows(const TArray<FString>& Rows);
+
+	void Reset();
+
+	// Rows containing #Query, in ascending order. Valid until the next call or change.
+	const TArray<int32>& Find(const FString& Query);
+
+	// Minimum number of rows tested by a single parallel task.
+	static constexpr int32 MinRowsPerTask = 8 * 1024;
+
+private:
+
+	struct FPosting
+	{
+		int32 Row;
+		uint32 Generation;
+	};
+
+	void IndexRow(int32 Row);
+	void UnindexRow(int32 Row);
+	void CompactIfNeeded();
+	void Verify(const int32* Rows, int32 Count, const FString& Query, TArray<int32>& OutRows) const;
+
+	TArray<FString> Texts; // lower case
+	TArray<uint32> Generations;
+	TArray<int32> NumTrigrams;
+	TBitArray<> Alive;
+
+	TMap<uint64, TArray<FPosting>> Postings;
+	int64 NumPostings = 0;
+	int64 NumStalePostings = 0;
+
+	uint32 Version = 0;
+
+	// last query, to answer repeated and extended queries
+	FString LastQuery;
+	uint32 LastVersion = MAX_uint32;
+	TArray<int32> Result;
+};
+
+// Blueprint handle to a search index. Copies of the struct share the same index.
+USTRUCT(BlueprintType)
+struct FImGuiSearchIndexHandle
+{
+	GENERATED_BODY()
+
+	TSharedPtr<FImGuiSearchIndex> Index;
+
+	bool IsValid() const { return Index.IsValid(); }
+};
+
+/*
+ *
+ */
+UCLASS()
+class IMGUI_API UImGuiSearchIndexFunction : public UBlueprintFunctionLibrary
+{
+	GENERATED_BODY()
+
+public:
+
+	UFUNCTION(BlueprintCallable, Category = "ImGui|Search")
+	static FImGuiSearchIndexHandle MakeSearchIndex(const TArray<FString>& rows)
+	{
+		FImGuiSearchIndexHandle Handle;
+		Handle.Index = MakeShared<FImGuiSearchIndex>();
+		Handle.Index->SetRows(rows);
+		return Handle;
+	}
+
+	// Re-indexes the rows whose text changed.
+	UFUNCTION(BlueprintCallable, Category = "ImGui|Search")
+	static void SearchIndexSetRows(UPARAM(ref) FImGuiSearchIndexHandle& index, const TArray<FString>& rows)
+	{
+		if (index.IsValid())
+		{
+			index.Index->SetRows(rows);
+		}
+	}
+
+	UFUNCTION(BlueprintCallable, Category = "ImGui|Search")
+	static void SearchIndexSetRow(UPARAM(ref) FImGuiSearchIndexHandle& index, int32 row, const FString& text)
+	{
+		if (index.IsValid())
+		{
+			index.Index->SetRow(row, text);
+		}
+	}
+
+	UFUNCTION(BlueprintCallable, Category = "ImGui|Search")
+	static int32 SearchIndexAddRow(UPARAM(ref) FImGuiSearchIndexHandle& index, const FString& text)
+	{
+		return index.IsValid() ? index.Index->AddRow(text) : INDEX_NONE;
+	}
+
+	UFUNCTION(BlueprintCallable, Category = "ImGui|Search")
+	static void SearchIndexRemoveRow(UPARAM(ref) FImGuiSearchIndexHandle& index, int32 row)
+	{
+		if (index.IsValid())
+		{
+			index.Index->RemoveRow(row);
+		}
+	}
+
+	// Finds the rows containing #query (case insensitive). Returns the number of matches, read them with SearchIndexGetMatch.
+	UFUNCTION(BlueprintCallable, Category = "ImGui|Search")
+	static int32 SearchIndexFind(UPARAM(ref) FImGuiSearchIndexHandle& index, const FString& query)
+	{
+		return index.IsValid() ? index.Index->Find(query).Num() : 0;
+	}
+
+	// Row of match #match_index of #query, or -1.
+	UFUNCTION(BlueprintCallable, Category = "ImGui|Search")
+	static int32 SearchIndexGetMatch(UPARAM(ref) FImGuiSearchIndexHandle& index, const FString& query, int32 match_index)
+	{
+		if (!index.IsValid())
+			return INDEX_NONE;
+		const TArray<int32>& Matches = index.Index->Find(query);
+		return Matches.IsValidIndex(match_index) ? Matches[match_index] : INDEX_NONE;
+	}
+
+	UFUNCTION(BlueprintCallable, Category = "ImGui|Search")
+	static void SearchIndexGetMatches(UPARAM(ref) FImGuiSearchIndexHandle& index, const FString& query, TArray<int32>& rows)
+	{
+		rows = index.IsValid() ? index.Index->Find(query) : TArray<int32>();
+	}
+};
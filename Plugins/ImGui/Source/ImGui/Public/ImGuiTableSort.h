@@ -0,0 +1,133 @@
+// Distributed under the MIT License (MIT) (see accompanying LICENSE file)
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Kismet/BlueprintFunctionLibrary.h"
+#include <imgui.h>
+
+#include "ImGuiTableSort.generated.h"
+
+// One sorted column of ImGuiTableSortSpecs.
+USTRUCT(BlueprintType)
+struct FImGuiTableColumnSortSpec
+{
+	GENERATED_BODY()
+
+	// index of the column
+	UPROPERTY(BlueprintReadWrite, Category = "ImGui|Tables|Sorting")
+	int32 ColumnIndex = 0;
+
+	// user id of the column, if set with TableSetupColumn
+	UPROPERTY(BlueprintReadWrite, Category = "ImGui|Tables|Sorting")
+	int32 ColumnUserID = 0;
+
+	// 0 for the primary key, 1 for the secondary one...
+	UPROPERTY(BlueprintReadWrite, Category = "ImGui|Tables|Sorting")
+	int32 SortOrder = 0;
+
+	UPROPERTY(BlueprintReadWrite, Category = "ImGui|Tables|Sorting")
+	bool bDescending = false;
+
+	bool operator==(const FImGuiTableColumnSortSpec& Other) const
+	{
+		return ColumnIndex == Other.ColumnIndex && ColumnUserID == Other.ColumnUserID && SortOrder == Other.SortOrder && bDescending == Other.bDescending;
+	}
+};
+
+/*
+ * Sorted row order of tables, kept per table name. Sort keys are given per column, once per data
+ * version, string keys are turned into ranks at that point so that sorting only compares numbers.
+ * The order is rebuilt only when the sort specs, the row count or the data version change. Ties are
+ * broken by row index, so sorting is stable and multi-column keys keep the order of the specs.
+ * Large tables are sorted in parallel chunks that are then merged.
+ */
+class IMGUI_API FImGuiTableSort
+{
+public:
+
+	// Reads the sort specs of the current table. Returns false outside a sortable table.
+	static bool GetSortSpecs(TArray<FImGuiTableColumnSortSpec>& OutSpecs, bool& bOutDirty, bool bClearDirty);
+
+	// Keys already set for the same #DataVersion and count are ignored, so they can be given every frame.
+	static void SetColumnKeys(FName Table, int32 Column, uint32 DataVersion, TArray<double>&& Keys);
+	static void SetColumnKeys(FName Table, int32 Column, uint32 DataVersion, const TArray<FString>& Keys);
+
+	// True if #Column of #Table holds #NumKeys keys of #DataVersion.
+	static bool HasColumnKeys(FName Table, int32 Column, uint32 DataVersion, int32 NumKeys);
+
+	// Updates the order of #Table from the sort specs of the current ImGui table. Returns true if it was re-sorted.
+	static bool Update(FName Table, int32 RowCount, uint32 DataVersion);
+
+	// Same with explicit specs, for tables sorted outside of ImGui::BeginTable.
+	static bool Update(FName Table, int32 RowCount, uint32 DataVersion, const TArray<FImGuiTableColumnSortSpec>& Specs);
+
+	// Row shown at #DisplayIndex, #DisplayIndex itself when the table is not sorted.
+	static int32 GetRow(FName Table, int32 DisplayIndex);
+	static const TArray<int32>* GetOrder(FName Table);
+
+	static void Remove(FName Table);
+
+	// Sorts #Order (row indices) by #Keys (one array per column), ties broken by row index.
+	static void SortRows(TArray<int32>& Order, const TArray<const TArray<double>*>& Keys, const TArray<bool>& Descending);
+
+	// Minimum number of rows sorted by a single parallel task.
+	static constexpr int32 MinRowsPerTask = 16 * 1024;
+};
+
+/*
+ *
+ */
+UCLASS()
+class IMGUI_API UImGuiTableSortFunction : public UBlueprintFunctionLibrary
+{
+	GENERATED_BODY()
+
+public:
+
+	// Sets the sort keys of #column of #table. Keys of an unchanged #data_version (and count) are skipped, so it can run every frame.
+	UFUNCTION(BlueprintCallable, Category = "ImGui|Tables|Sorting")
+	static void TableSetSortKeysFloat(FName table, int32 column, const TArray<float>& keys, int32 data_version)
+	{
+		if (FImGuiTableSort::HasColumnKeys(table, column, (uint32)data_version, keys.Num()))
+			return;
+		TArray<double> Keys(keys);
+		FImGuiTableSort::SetColumnKeys(table, column, (uint32)data_version, MoveTemp(Keys));
+	}
+
+	UFUNCTION(BlueprintCallable, Category = "ImGui|Tables|Sorting")
+	static void TableSetSortKeysInt(FName table, int32 column, const TArray<int32>& keys, int32 data_version)
+	{
+		if (FImGuiTableSort::HasColumnKeys(table, column, (uint32)data_version, keys.Num()))
+			return;
+		TArray<double> Keys(keys);
+		FImGuiTableSort::SetColumnKeys(table, column, (uint32)data_version, MoveTemp(Keys));
+	}
+
+	UFUNCTION(BlueprintCallable, Category = "ImGui|Tables|Sorting")
+	static void TableSetSortKeysString(FName table, int32 column, const TArray<FString>& keys, int32 data_version)
+	{
+		FImGuiTableSort::SetColumnKeys(table, column, (uint32)data_version, keys);
+	}
+
+	// Call between BeginTable and the rows. Re-sorts #table only if the sort specs, #row_count or #data_version changed.
+	UFUNCTION(BlueprintCallable, Category = "ImGui|Tables|Sorting")
+	static bool TableSortRows(FName table, int32 row_count, int32 data_version)
+	{
+		return FImGuiTableSort::Update(table, row_count, (uint32)data_version);
+	}
+
+	// Data row to show at #display_index.
+	UFUNCTION(BlueprintPure, Category = "ImGui|Tables|Sorting")
+	static int32 TableGetSortedRow(FName table, int32 display_index)
+	{
+		return FImGuiTableSort::GetRow(table, display_index);
+	}
+
+	UFUNCTION(BlueprintCallable, Category = "ImGui|Tables|Sorting")
+	static void TableGetSortedRows(FName table, TArray<int32>& rows)
+	{
+		const TArray<int32>* Order = FImGuiTableSort::GetOrder(table);
+		rows = Order ? *Order : TArray<int32>();
+	}
+};
@@ -0,0 +1,65 @@
+// Distributed under the MIT License (MIT) (see accompanying LICENSE file)
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/WeakObjectPtr.h"
+#include "Engine/Texture2D.h"
+
+#include "ImGuiModule.h"
+#include "ImGuiTextureCache.generated.h"
+
+// Texture resolved to an ImGui texture handle. Store it in a Blueprint variable and pass it to the
+// cached image nodes: as long as it refers to the same texture, no lookup happens at all.
+USTRUCT(BlueprintType)
+struct FImGuiTexture
+{
+	GENERATED_BODY()
+
+	// weak, the struct never keeps the texture alive
+	UPROPERTY()
+	TWeakObjectPtr<UTexture2D> Texture;
+
+	FImGuiTextureHandle Handle;
+
+	// cache generation the handle was resolved in
+	uint32 Generation = 0;
+};
+
+/*
+ * Maps textures to ImGui texture handles. Textures are registered once, under their path name so that
+ * equally named textures from different packages do not collide, and looked up by weak pointer instead of
+ * by name. Entries whose texture has been garbage collected are unregistered after every GC.
+ */
+class IMGUI_API FImGuiTextureCache
+{
+public:
+
+	static FImGuiTextureCache& Get();
+
+	// Returns the handle of #Texture, registering it on first use. Returns an invalid handle for null textures.
+	FImGuiTextureHandle FindOrRegister(UTexture2D* Texture);
+
+	// Resolves #Texture into its handle, skipping the lookup when it is still valid.
+	const FImGuiTextureHandle& Resolve(FImGuiTexture& Texture);
+
+	// Unregisters #Texture now instead of waiting for it to be garbage collected.
+	void Release(UTexture2D* Texture);
+
+	// Unregisters all entries whose texture is gone.
+	void ReleaseStale();
+
+	int32 Num() const { return Handles.Num(); }
+
+private:
+
+	FImGuiTextureCache();
+	~FImGuiTextureCache();
+
+	FDelegateHandle PostGarbageCollectHandle;
+
+	TMap<TWeakObjectPtr<UTexture2D>, FImGuiTextureHandle> Handles;
+
+	// bumped whenever a handle is released, so handles stored in FImGuiTexture are resolved again
+	uint32 Generation = 1;
+};
@@ -0,0 +1,244 @@
+// Distributed under the MIT License (MIT) (see accompanying LICENSE file)
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Kismet/BlueprintFunctionLibrary.h"
+
+#include "ImGuiVirtualTree.generated.h"
+
+// Called with node #node of a virtual tree.
+DECLARE_DYNAMIC_DELEGATE_OneParam(FImGuiTreeNodeDelegate, int32, node);
+
+/*
+ * Tree view for large hierarchies. The tree owns its nodes and their expanded state, and keeps the
+ * rows of the expanded part flattened in display order: expanding a node inserts its visible
+ * descendants after its row, collapsing removes them, so collapsed branches are never walked. The
+ * rows are drawn through a list clipper, a frame only touches the rows on screen.
+ *
+ * Nodes created with #bHasChildren are populated lazily, OnPopulate is called the first time they
+ * are expanded. Adding or removing nodes under an expanded branch re-flattens the rows once, on the
+ * next draw.
+ */
+class IMGUI_API FImGuiVirtualTree
+{
+public:
+
+	FImGuiVirtualTree();
+
+	// Adds a node as last child of #Parent (INDEX_NONE for a root node). Returns the node id, ids stay valid until the node is removed.
+	int32 AddNode(int32 Parent, const FString& Label, bool bHasChildren = false, int32 UserValue = 0);
+
+	// Removes #Node and its subtree.
+	void RemoveNode(int32 Node);
+
+	// Removes the subtree of #Node (all nodes for INDEX_NONE). Lazy nodes are populated again on their next expand.
+	void RemoveChildren(int32 Node);
+
+	void Reset();
+	void Reserve(int32 NumNodes);
+
+	bool IsValidNode(int32 Node) const { return Node > 0 && Nodes.IsValidIndex(Node) && Nodes[Node].bUsed; }
+	int32 Num() const { return NumUsed; }
+
+	void SetLabel(int32 Node, const FString& Label);
+	int32 GetUserValue(int32 Node) const { return IsValidNode(Node) ? Nodes[Node].UserValue : 0; }
+	int32 GetParent(int32 Node) const { return IsValidNode(Node) && Nodes[Node].Parent > 0 ? Nodes[Node].Parent : INDEX_NONE; }
+
+	bool IsExpanded(int32 Node) const { return IsValidNode(Node) && Nodes[Node].bExpanded; }
+	void SetExpanded(int32 Node, bool bExpanded) { SetExpandedAt(Node, bExpanded, INDEX_NONE); }
+
+	// Expands the ancestors of #Node, so it gets a row.
+	void Reveal(int32 Node);
+
+	void CollapseAll();
+
+	// Node of each row, in display order.
+	const TArray<int32>& GetVisibleRows();
+
+	int32 GetSelected() const { return Selected; }
+	void SetSelected(int32 Node) { Selected = IsValidNode(Node) ? Node : INDEX_NONE; }
+
+	// Draws the visible rows, one tree node per row. #DrawRow is called after the tree node of each
+	// row on screen, for extra table cells, and must not change the tree. With #bTableRows each row
+	// starts a table row. Returns true if the selection changed.
+	bool Draw(const TFunction<void(int32 Node)>& DrawRow = nullptr, bool bTableRows = false);
+
+	// Called the first time a node created with bHasChildren is expanded, to add its children.
+	TFunction<void(int32 Node)> OnPopulate;
+
+private:
+
+	struct FNode
+	{
+		int32 Parent = INDEX_NONE;
+		int32 FirstChild = INDEX_NONE;
+		int32 LastChild = INDEX_NONE;
+		int32 PrevSibling = INDEX_NONE;
+		int32 NextSibling = INDEX_NONE;
+		int32 Depth = 0;
+		int32 UserValue = 0;
+		TArray<ANSICHAR> Label; // UTF-8, null terminated
+		bool bUsed = false;
+		bool bExpanded = false;
+		bool bHasChildren = false;
+		bool bPopulated = false;
+
+		bool IsLeaf() const { return FirstChild == INDEX_NONE && (!bHasChildren || bPopulated); }
+	};
+
+	void SetExpandedAt(int32 Node, bool bExpanded, int32 RowHint);
+
+	// Calls #Func for the descendants of #Node in display order, only entering expanded nodes if #bExpandedOnly.
+	template<typename FuncType>
+	void ForEachDescendant(int32 Node, bool bExpandedOnly, FuncType Func) const;
+
+	// True if all ancestors of #Node are expanded.
+	bool HasRow(int32 Node) const;
+	int32 FindRow(int32 Node, int32 RowHint) const;
+	void RemoveRows(int32 Row, int32 Depth);
+
+	void Unlink(int32 Node);
+	void FreeSubtree(int32 Node);
+
+	// node 0 is the hidden root
+	TArray<FNode> Nodes;
+	TArray<int32> FreeNodes;
+	int32 NumUsed = 0;
+
+	TArray<int32> Rows;
+	bool bRowsDirty = false;
+
+	int32 Selected = INDEX_NONE;
+};
+
+// Blueprint handle to a virtual tree. Copies of the struct share the same tree.
+USTRUCT(BlueprintType)
+struct FImGuiVirtualTreeHandle
+{
+	GENERATED_BODY()
+
+	TSharedPtr<FImGuiVirtualTree> Tree;
+
+	bool IsValid() const { return Tree.IsValid(); }
+};
+
+/*
+ *
+ */
+UCLASS()
+class IMGUI_API UImGuiVirtualTreeFunction : public UBlueprintFunctionLibrary
+{
+	GENERATED_BODY()
+
+public:
+
+	// Makes an empty tree. #on_populate is called the first time a node added with has_children is expanded.
+	UFUNCTION(BlueprintCallable, Category = "ImGui|Tree")
+	static FImGuiVirtualTreeHandle MakeVirtualTree(const FImGuiTreeNodeDelegate& on_populate)
+	{
+		FImGuiVirtualTreeHandle Handle;
+		Handle.Tree = MakeShared<FImGuiVirtualTree>();
+		if (on_populate.IsBound())
+		{
+			Handle.Tree->OnPopulate = [on_populate](int32 Node) { on_populate.ExecuteIfBound(Node); };
+		}
+		return Handle;
+	}
+
+	// Adds a node as last child of #parent (-1 for a root node). Returns the node id.
+	UFUNCTION(BlueprintCallable, Category = "ImGui|Tree", meta = (AdvancedDisplay = "3"))
+	static int32 VirtualTreeAddNode(UPARAM(ref) FImGuiVirtualTreeHandle& tree, int32 parent, const FString& label, bool has_children = false, int32 user_value = 0)
+	{
+		return tree.IsValid() ? tree.Tree->AddNode(parent, label, has_children, user_value) : INDEX_NONE;
+	}
+
+	UFUNCTION(BlueprintCallable, Category = "ImGui|Tree")
+	static void VirtualTreeRemoveNode(UPARAM(ref) FImGuiVirtualTreeHandle& tree, int32 node)
+	{
+		if (tree.IsValid())
+		{
+			tree.Tree->RemoveNode(node);
+		}
+	}
+
+	// Removes the subtree of #node (all nodes for -1).
+	UFUNCTION(BlueprintCallable, Category = "ImGui|Tree")
+	static void VirtualTreeRemoveChildren(UPARAM(ref) FImGuiVirtualTreeHandle& tree, int32 node)
+	{
+		if (tree.IsValid())
+		{
+			tree.Tree->RemoveChildren(node);
+		}
+	}
+
+	UFUNCTION(BlueprintCallable, Category = "ImGui|Tree")
+	static void VirtualTreeSetLabel(UPARAM(ref) FImGuiVirtualTreeHandle& tree, int32 node, const FString& label)
+	{
+		if (tree.IsValid())
+		{
+			tree.Tree->SetLabel(node, label);
+		}
+	}
+
+	UFUNCTION(BlueprintCallable, Category = "ImGui|Tree")
+	static void VirtualTreeSetExpanded(UPARAM(ref) FImGuiVirtualTreeHandle& tree, int32 node, bool expanded)
+	{
+		if (tree.IsValid())
+		{
+			tree.Tree->SetExpanded(node, expanded);
+		}
+	}
+
+	UFUNCTION(BlueprintCallable, Category = "ImGui|Tree")
+	static bool VirtualTreeIsExpanded(UPARAM(ref) FImGuiVirtualTreeHandle& tree, int32 node)
+	{
+		return tree.IsValid() && tree.Tree->IsExpanded(node);
+	}
+
+	// Expands the ancestors of #node.
+	UFUNCTION(BlueprintCallable, Category = "ImGui|Tree")
+	static void VirtualTreeReveal(UPARAM(ref) FImGuiVirtualTreeHandle& tree, int32 node)
+	{
+		if (tree.IsValid())
+		{
+			tree.Tree->Reveal(node);
+		}
+	}
+
+	UFUNCTION(BlueprintCallable, Category = "ImGui|Tree")
+	static int32 VirtualTreeGetUserValue(UPARAM(ref) FImGuiVirtualTreeHandle& tree, int32 node)
+	{
+		return tree.IsValid() ? tree.Tree->GetUserValue(node) : 0;
+	}
+
+	UFUNCTION(BlueprintCallable, Category = "ImGui|Tree")
+	static int32 VirtualTreeGetSelected(UPARAM(ref) FImGuiVirtualTreeHandle& tree)
+	{
+		return tree.IsValid() ? tree.Tree->GetSelected() : INDEX_NONE;
+	}
+
+	UFUNCTION(BlueprintCallable, Category = "ImGui|Tree")
+	static void VirtualTreeSetSelected(UPARAM(ref) FImGuiVirtualTreeHandle& tree, int32 node)
+	{
+		if (tree.IsValid())
+		{
+			tree.Tree->SetSelected(node);
+		}
+	}
+
+	// Draws the visible rows of #tree. #draw_row is called after the tree node of each row on screen. Returns true if the selection changed.
+	UFUNCTION(BlueprintCallable, Category = "ImGui|Tree", meta = (AdvancedDisplay = "2"))
+	static bool DrawVirtualTree(UPARAM(ref) FImGuiVirtualTreeHandle& tree, const FImGuiTreeNodeDelegate& draw_row, bool table_rows, int32& selected)
+	{
+		selected = INDEX_NONE;
+		if (!tree.IsValid())
+			return false;
+
+		const bool bChanged = draw_row.IsBound()
+			? tree.Tree->Draw([&draw_row](int32 Node) { draw_row.ExecuteIfBound(Node); }, table_rows)
+			: tree.Tree->Draw(nullptr, table_rows);
+		selected = tree.Tree->GetSelected();
+		return bChanged;
+	}
+};
@@ -0,0 +1,141 @@
+// Distributed under the MIT License (MIT) (see accompanying LICENSE file)
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/ActorComponent.h"
+#include "UObject/ObjectKey.h"
+
+#include "ImGuiSearchIndex.h"
+#include "ImGuiWorldOutliner.generated.h"
+
+class AActor;
+class ULevel;
+class UWorld;
+
+/*
+ * Actor outliner for large worlds. The actor snapshot is kept up to date from the world spawn and
+ * delete events and from level streaming, with a name index (trigram search) and a class index.
+ * Scanning newly added levels and sweeping out actors destroyed behind our back (and refreshing
+ * labels) is time sliced: Update only spends the given budget per frame and resumes where it
+ * stopped. The window draws the filtered rows through a list clipper, and the selected actor
+ * through the property inspector.
+ */
+class IMGUI_API FImGuiWorldOutliner
+{
+public:
+
+	explicit FImGuiWorldOutliner(UWorld* InWorld);
+	~FImGuiWorldOutliner();
+
+	// Spends up to #BudgetMs scanning levels and validating the snapshot.
+	void Update(double BudgetMs);
+
+	void Draw(const char* WindowName, bool* bOpen = nullptr, bool bShowDetails = true);
+
+	int32 NumActors() const { return NumAlive; }
+	int32 NumPendingLevels() const { return PendingLevels.Num(); }
+
+	AActor* GetSelected() const;
+
+	// Slots of the actors matching the name filter and class filter, in slot order.
+	const TArray<int32>& GetFilteredSlots();
+
+	void SetFilter(const FString& Query, UClass* Class);
+
+	// Actors checked per budget test while scanning and validating.
+	static constexpr int32 ItemsPerTimeCheck = 64;
+
+private:
+
+	struct FEntry
+	{
+		TWeakObjectPtr<AActor> Actor;
+		FObjectKey Key;
+		FObjectKey Level;
+		TWeakObjectPtr<UClass> Class;
+		FString Label;
+		bool bAlive = false;
+	};
+
+	static FString GetLabel(const AActor* Actor);
+
+	void AddActor(AActor* Actor);
+	void RemoveSlot(int32 Slot);
+
+	void OnActorSpawned(AActor* Actor);
+	void OnActorDeleted(AActor* Actor);
+	void OnLevelAdded(ULevel* Level, UWorld* InWorld);
+	void OnLevelRemoved(ULevel* Level, UWorld* InWorld);
+
+	void DrawClassFilter();
+	void DrawRows();
+	void DrawDetails();
+
+	TWeakObjectPtr<UWorld> World;
+
+	TArray<FEntry> Entries;
+	TArray<int32> FreeSlots;
+	TMap<FObjectKey, int32> SlotByActor;
+	TMap<TWeakObjectPtr<UClass>, int32> ClassCounts;
+	FImGuiSearchIndex NameIndex;
+	int32 NumAlive = 0;
+	uint32 Version = 0;
+
+	// time slicing
+	TArray<TWeakObjectPtr<ULevel>> PendingLevels;
+	int32 ScanIndex = 0;
+	int32 ValidateCursor = 0;
+
+	// filter
+	char FilterText[256] = {};
+	FString Query;
+	TWeakObjectPtr<UClass> FilterClass;
+	TArray<int32> Filtered;
+	uint32 FilteredVersion = MAX_uint32;
+	bool bFilterDirty = true;
+
+	int32 Selected = INDEX_NONE;
+
+	FDelegateHandle ActorSpawnedHandle;
+	FDelegateHandle ActorDeletedHandle;
+	FDelegateHandle LevelAddedHandle;
+	FDelegateHandle LevelRemovedHandle;
+};
+
+// Drop-in debug component drawing a world outliner, next to UImGuiComponent.
+UCLASS(Blueprintable, meta=(BlueprintSpawnableComponent))
+class IMGUI_API UImGuiWorldOutlinerComponent : public UActorComponent
+{
+	GENERATED_BODY()
+
+public:
+
+	UImGuiWorldOutlinerComponent();
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ImGui|Outliner")
+	FString WindowName = TEXT("World Outliner");
+
+	// Time spent per frame scanning levels and validating the snapshot.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ImGui|Outliner")
+	float TimeBudgetMs = 0.5f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ImGui|Outliner")
+	bool bShowDetails = true;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ImGui|Outliner")
+	bool bOpen = true;
+
+	UFUNCTION(BlueprintPure, Category = "ImGui|Outliner")
+	AActor* GetSelectedActor() const { return Outliner ? Outliner->GetSelected() : nullptr; }
+
+protected:
+
+	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
+	void ImGuiTick();
+
+	FDelegateHandle ImGuiTickHandle;
+	TUniquePtr<FImGuiWorldOutliner> Outliner;
+};
@@ -0,0 +1,85 @@
+// Distributed under the MIT License (MIT) (see accompanying LICENSE file)
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Kismet/BlueprintFunctionLibrary.h"
+
+#include "ImGuiDrawListBatch.h"
+#include "ImGuiWorldOverlay.generated.h"
+
+class APlayerController;
+
+// View used to project world positions to ImGui screen coordinates.
+struct IMGUI_API FImGuiOverlayView
+{
+	FMatrix ViewProjection = FMatrix::Identity;
+	FVector ViewOrigin = FVector::ZeroVector;
+
+	// view rect in ImGui display coordinates
+	FVector2D ScreenMin = FVector2D::ZeroVector;
+	FVector2D ScreenSize = FVector2D::ZeroVector;
+
+	// Builds the view of #Player's viewport. Returns false if the player has no local viewport.
+	static bool FromPlayer(const APlayerController* Player, FImGuiOverlayView& OutView);
+};
+
+/*
+ * World space debug overlay. Positions are projected in one SIMD pass (four at a time, in parallel for
+ * large inputs), culled against the view frustum and a distance limit, and what survives is drawn with
+ * the batch draw list primitives. Labels are placed nearest first on a coarse screen grid, and a label
+ * that would cover a cell already taken is dropped.
+ */
+class IMGUI_API FImGuiWorldOverlay
+{
+public:
+
+	enum EProjectionFlags : uint8
+	{
+		InFront = 1 << 0, // in front of the camera
+		InView = 1 << 1,  // inside the frustum (widened by the margin)
+		InRange = 1 << 2, // within the distance limit
+		Visible = InFront | InView | InRange
+	};
+
+	// Projects #Count positions to screen positions, depths (clip W) and EProjectionFlags.
+	// #Margin widens the frustum in NDC units, #MaxDistance <= 0 disables the distance limit.
+	static void Project(const FImGuiOverlayView& View, const FVector* Positions, int32 Count, float MaxDistance, float Margin,
+		TArray<FVector2D>& OutScreen, TArray<float>& OutDepth, TArray<uint8>& OutFlags);
+
+	// Draws the visible positions as dots with optional labels. Returns the number of drawn positions.
+	static int32 DrawPoints(ImDrawList* DrawList, const FImGuiOverlayView& View, const FVector* Positions, int32 Count,
+		const FString* Labels, int32 NumLabels, const ImU32* Colors, int32 NumColors, float MaxDistance, float PointRadius, bool bDeclutter);
+
+	// Draws the visible boxes as wireframes with optional labels above them. Returns the number of drawn boxes.
+	static int32 DrawBoxes(ImDrawList* DrawList, const FImGuiOverlayView& View, const FBox* Boxes, int32 Count,
+		const FString* Labels, int32 NumLabels, const ImU32* Colors, int32 NumColors, float MaxDistance, float Thickness, bool bDeclutter);
+
+	// Minimum number of positions handled by a single parallel task.
+	static constexpr int32 MinPositionsPerTask = 16 * 1024;
+
+	// Size of the label placement grid cells, in pixels.
+	static constexpr float GridCellSize = 8.0f;
+};
+
+/*
+ *
+ */
+UCLASS()
+class IMGUI_API UImGuiWorldOverlayFunction : public UBlueprintFunctionLibrary
+{
+	GENERATED_BODY()
+
+public:
+
+	// Draws #positions of the world as dots, with #labels (optional, one per position). #colors holds one color per position or a single one.
+	// #max_distance <= 0 draws at any distance. Returns the number of positions on screen.
+	UFUNCTION(BlueprintCallable, Category = "ImGui|WorldOverlay", meta = (WorldContext = "WorldContextObject", AdvancedDisplay = "4"))
+	static int32 DrawWorldPoints(const UObject* WorldContextObject, const TArray<FVector>& positions, const TArray<FString>& labels, const TArray<FLinearColor>& colors,
+		float max_distance = 0.0f, float point_radius = 3.0f, bool declutter_labels = true, int32 player_index = 0, EImGuiDrawList target = EImGuiDrawList::Background);
+
+	// Draws #boxes of the world as wireframes, with #labels (optional, one per box) above them. Returns the number of boxes on screen.
+	UFUNCTION(BlueprintCallable, Category = "ImGui|WorldOverlay", meta = (WorldContext = "WorldContextObject", AdvancedDisplay = "4"))
+	static int32 DrawWorldBoxes(const UObject* WorldContextObject, const TArray<FBox>& boxes, const TArray<FString>& labels, const TArray<FLinearColor>& colors,
+		float max_distance = 0.0f, float thickness = 1.0f, bool declutter_labels = true, int32 player_index = 0, EImGuiDrawList target = EImGuiDrawList::Background);
+};
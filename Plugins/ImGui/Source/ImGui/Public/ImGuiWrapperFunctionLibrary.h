@@ -6,7 +6,10 @@
 #include "Kismet/BlueprintFunctionLibrary.h"
 #include "ImGuiInteroperability.h"
 
+#include "ImGuiAsyncLog.h"
 #include "ImGuiModule.h"
+#include "ImGuiTableSort.h"
+#include "ImGuiTextureCache.h"
 
 #include "ImGuiWrapperFunctionLibrary.generated.h"
 
@@ -961,19 +964,63 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "ImGui|Widgets|Main")
 	static void Image(UTexture2D* user_texture_id, const FVector2D& size, FVector2D uv0, FVector2D uv1, UPARAM(ref) FLinearColor& tint_col, UPARAM(ref) FLinearColor& border_col)
 	{
-		FImGuiTextureHandle handle = FImGuiModule::Get().FindTextureHandle(user_texture_id->GetFName());
+		const FImGuiTextureHandle handle = FImGuiTextureCache::Get().FindOrRegister(user_texture_id);
 		if(!handle.IsValid())
-		{
-			handle = FImGuiModule::Get().RegisterTexture(user_texture_id->GetFName(), user_texture_id);
-		}
-		
+			return;
+
+		ImGui::Image(handle, ToImVec2(size), ToImVec2(uv0), ToImVec2(uv1),ToImVec4(tint_col), ToImVec4(border_col));
+	}
+
+	// same as Image, but with a texture resolved by MakeImGuiTexture (no lookup per frame)
+	UFUNCTION(BlueprintCallable, Category = "ImGui|Widgets|Main")
+	static void ImageCached(UPARAM(ref) FImGuiTexture& texture, const FVector2D& size, FVector2D uv0, FVector2D uv1, FLinearColor tint_col = FLinearColor(1,1,1,1), FLinearColor border_col = FLinearColor(0,0,0,0))
+	{
+		const FImGuiTextureHandle& handle = FImGuiTextureCache::Get().Resolve(texture);
+		if(!handle.IsValid())
+			return;
+
 		ImGui::Image(handle, ToImVec2(size), ToImVec2(uv0), ToImVec2(uv1),ToImVec4(tint_col), ToImVec4(border_col));
 	}
 
 	// <0 frame_padding uses default frame padding settings. 0 for no padding
-	//UFUNCTION(BlueprintCallable, Category = "ImGui|Widgets|Main")
-	//static bool ImageButton(ImTextureID user_texture_id, const ImVec2& size, const ImVec2& uv0 = ImVec2(0, 0),  const ImVec2& uv1 = ImVec2(1,1), int frame_padding = -1, const ImVec4& bg_col = ImVec4(0,0,0,0), const ImVec4& tint_col = ImVec4(1,1,1,1))
-	//{ return ImGui::ImageButton();}
+	UFUNCTION(BlueprintCallable, Category = "ImGui|Widgets|Main", meta = (ExpandEnumAsExecs="OutResult"))
+	static void ImageButton(UTexture2D* user_texture_id, const FVector2D& size, TEnumAsByte<EImGuiButton::Type>& OutResult, FVector2D uv0 = FVector2D(0,0), FVector2D uv1 = FVector2D(1,1), int32 frame_padding = -1, FLinearColor bg_col = FLinearColor(0,0,0,0), FLinearColor tint_col = FLinearColor(1,1,1,1))
+	{
+		OutResult = EImGuiButton::None;
+		const FImGuiTextureHandle handle = FImGuiTextureCache::Get().FindOrRegister(user_texture_id);
+		if(!handle.IsValid())
+			return;
+
+		if(ImGui::ImageButton(handle, ToImVec2(size), ToImVec2(uv0), ToImVec2(uv1), frame_padding, ToImVec4(bg_col), ToImVec4(tint_col)))
+			OutResult = EImGuiButton::Pressed;
+	}
+
+	// same as ImageButton, but with a texture resolved by MakeImGuiTexture (no lookup per frame)
+	UFUNCTION(BlueprintCallable, Category = "ImGui|Widgets|Main", meta = (ExpandEnumAsExecs="OutResult"))
+	static void ImageButtonCached(UPARAM(ref) FImGuiTexture& texture, const FVector2D& size, TEnumAsByte<EImGuiButton::Type>& OutResult, FVector2D uv0 = FVector2D(0,0), FVector2D uv1 = FVector2D(1,1), int32 frame_padding = -1, FLinearColor bg_col = FLinearColor(0,0,0,0), FLinearColor tint_col = FLinearColor(1,1,1,1))
+	{
+		OutResult = EImGuiButton::None;
+		const FImGuiTextureHandle& handle = FImGuiTextureCache::Get().Resolve(texture);
+		if(!handle.IsValid())
+			return;
+
+		if(ImGui::ImageButton(handle, ToImVec2(size), ToImVec2(uv0), ToImVec2(uv1), frame_padding, ToImVec4(bg_col), ToImVec4(tint_col)))
+			OutResult = EImGuiButton::Pressed;
+	}
+
+	// resolves #texture into a handle that can be stored and passed to ImageCached, ImageButtonCached and PlotImageCached. The texture is held weakly.
+	UFUNCTION(BlueprintPure, Category = "ImGui|Widgets|Main")
+	static FImGuiTexture MakeImGuiTexture(UTexture2D* texture)
+	{
+		FImGuiTexture result;
+		result.Texture = texture;
+		FImGuiTextureCache::Get().Resolve(result);
+		return result;
+	}
+
+	// unregisters #texture from ImGui now instead of after it is garbage collected
+	UFUNCTION(BlueprintCallable, Category = "ImGui|Widgets|Main")
+	static void ReleaseImGuiTexture(UTexture2D* texture) { FImGuiTextureCache::Get().Release(texture); }
 
 	UFUNCTION(BlueprintCallable, Category = "ImGui|Widgets|Main", meta = (ExpandEnumAsExecs="OutResult"))
 	static void Checkbox(const FString& label, UPARAM(ref) bool& v, TEnumAsByte<EImGuiButton::Type>& OutResult)
@@ -1633,9 +1680,10 @@ public:
 	// Tables: Sorting
 	
 
-	// get latest sort specs for the table (NULL if not sorting).
-	//UFUNCTION(BlueprintCallable, Category = "ImGui|Tables|Sorting")
-	//static ImGuiTableSortSpecs* TableGetSortSpecs() { return ImGui::TableGetSortSpecs(); }
+	// get latest sort specs for the table (false if not sorting). specs_dirty is set when they changed since the last call that cleared it.
+	UFUNCTION(BlueprintCallable, Category = "ImGui|Tables|Sorting", meta = (AdvancedDisplay = "2"))
+	static bool TableGetSortSpecs(TArray<FImGuiTableColumnSortSpec>& specs, bool& specs_dirty, bool clear_dirty = true)
+	{ return FImGuiTableSort::GetSortSpecs(specs, specs_dirty, clear_dirty); }
 	
 	// Tables: Miscellaneous functions
 	// - Functions args 'int column_n' treat the default value of -1 as the same as passing the current column index.
@@ -1741,14 +1789,14 @@ public:
 
 
 	
-	// start logging to tty (stdout)
+	// start logging to tty (stdout). the text is written on a background thread when flushed or finished
 	UFUNCTION(BlueprintCallable, Category = "ImGui|Logging/Capture")
-	static void LogToTTY(int32 auto_open_depth = -1) { ImGui::LogToTTY(auto_open_depth); }
+	static void LogToTTY(int32 auto_open_depth = -1) { FImGuiAsyncLog::Get().LogToTTY(auto_open_depth); }
 
-	// start logging to file
+	// start logging to file. the text is written on a background thread when flushed or finished
 	UFUNCTION(BlueprintCallable, Category = "ImGui|Logging/Capture")
 	static void LogToFile(const FString& filename, int32 auto_open_depth = -1)
-	{ ImGui::LogToFile(auto_open_depth, TCHAR_TO_ANSI(*filename)); }
+	{ FImGuiAsyncLog::Get().LogToFile(filename, auto_open_depth); }
 
 	// start logging to OS clipboard
 	UFUNCTION(BlueprintCallable, Category = "ImGui|Logging/Capture")
@@ -1756,7 +1804,11 @@ public:
 
 	// stop logging (close file, etc.)
 	UFUNCTION(BlueprintCallable, Category = "ImGui|Logging/Capture")
-	static void LogFinish(){ ImGui::LogFinish(); }
+	static void LogFinish(){ FImGuiAsyncLog::Get().LogFinish(); }
+
+	// hand the text logged so far to the file/tty writer, for captures spanning several frames
+	UFUNCTION(BlueprintCallable, Category = "ImGui|Logging/Capture")
+	static void LogFlush(){ FImGuiAsyncLog::Get().Flush(); }
 
 	// helper to display buttons for logging to tty/file/clipboard
 	UFUNCTION(BlueprintCallable, Category = "ImGui|Logging/Capture")
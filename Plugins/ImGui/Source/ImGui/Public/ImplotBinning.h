@@ -0,0 +1,145 @@
+// Distributed under the MIT License (MIT) (see accompanying LICENSE file)
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Kismet/BlueprintFunctionLibrary.h"
+#include <implot.h>
+
+#include "ImplotWrapperFunctionLibrary.h"
+#include "ImplotBinning.generated.h"
+
+// Result of a 2D binning pass. Values are stored row-major with row 0 at the top (max Y),
+// which is the layout PlotHeatmap expects, so the grid can be plotted without a copy.
+USTRUCT(BlueprintType)
+struct FImPlotBinnedGrid
+{
+	GENERATED_BODY()
+
+	// bin counts (or densities), Rows * Cols entries
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
+	TArray<float> Values;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
+	int32 Rows = 0;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
+	int32 Cols = 0;
+
+	// the range that was actually binned (resolved from the data when the requested range is empty)
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
+	FImPlotLimits Bounds;
+
+	// largest bin count or density
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
+	float MaxValue = 0.0f;
+
+	// number of points that fell inside Bounds
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
+	int32 BinnedCount = 0;
+
+	// incremented every time the grid is rebuilt
+	int32 Revision = 0;
+
+	// cache key of the last binning pass
+	const void* CachedXs = nullptr;
+	const void* CachedYs = nullptr;
+	int32 CachedCount = -1;
+	int32 CachedVersion = 0;
+	uint32 CachedFingerprint = 0;
+	int32 CachedXBins = 0;
+	int32 CachedYBins = 0;
+	bool bCachedDensity = false;
+	bool bCachedOutliers = false;
+	ImPlotLimits CachedRange;
+
+	// Forces the next binning call to re-bin.
+	void Invalidate() { CachedCount = -1; }
+};
+
+/*
+ * Native 2D binning engine. Points are binned in parallel chunks into per-task partial grids,
+ * which are then summed with a SIMD reduction. The result is cached in the grid until the
+ * inputs (pointer, count, data version, sampled fingerprint), the range or the bin setup change.
+ */
+class IMGUI_API FImPlotBinning
+{
+public:
+
+	// Bins #Count (x, y) pairs into #Grid. #XBins and #YBins can be a positive integer or an ImPlotBin_ method.
+	// If #Range is empty on an axis, the min/max of the data is used. Bump #DataVersion when the data changes in place.
+	// Returns true if the grid was rebuilt, false if the cached result was still valid.
+	static bool Histogram2D(FImPlotBinnedGrid& Grid, const float* Xs, const float* Ys, int32 Count, int32 XBins, int32 YBins, bool bDensity, const ImPlotLimits& Range, bool bOutliers, int32 DataVersion = 0);
+	static bool Histogram2D(FImPlotBinnedGrid& Grid, const int32* Xs, const int32* Ys, int32 Count, int32 XBins, int32 YBins, bool bDensity, const ImPlotLimits& Range, bool bOutliers, int32 DataVersion = 0);
+
+	// Resolves an ImPlotBin_ method (negative) into a bin count for #Count samples spanning #Size with deviation #StdDev.
+	static int32 ResolveBinCount(int32 Bins, int32 Count, double Size, double StdDev);
+
+	// Minimum number of points handled by a single parallel task.
+	static constexpr int32 MinPointsPerTask = 16 * 1024;
+};
+
+/*
+ *
+ */
+UCLASS()
+class IMGUI_API UImPlotBinningFunction : public UBlueprintFunctionLibrary
+{
+	GENERATED_BODY()
+
+public:
+
+	// Bins two dimensional data into #Grid. The grid is only rebuilt when the inputs or the range change. Leave a range at (0,0) to use the data min/max.
+	// Bump #DataVersion whenever the arrays are modified in place. Returns true if the grid was rebuilt.
+	UFUNCTION(BlueprintCallable, Category = "ImPlot|Binning", meta = (AdvancedDisplay = "5"))
+	static bool BinHistogram2DFloat(UPARAM(ref) FImPlotBinnedGrid& Grid, const TArray<float>& xs, const TArray<float>& ys, FVector2D X_Range, FVector2D Y_Range,
+		UPARAM(meta=(Bitmask, BitmaskEnum=EImPlotBin)) int32 x_bins = -2, UPARAM(meta=(Bitmask, BitmaskEnum=EImPlotBin)) int32 y_bins = -2, bool density = false, bool outliers = true, int32 DataVersion = 0)
+	{
+		return FImPlotBinning::Histogram2D(Grid, xs.GetData(), ys.GetData(), FMath::Min(xs.Num(), ys.Num()), x_bins, y_bins, density, ImPlotLimits(X_Range.X, X_Range.Y, Y_Range.X, Y_Range.Y), outliers, DataVersion);
+	}
+
+	UFUNCTION(BlueprintCallable, Category = "ImPlot|Binning", meta = (AdvancedDisplay = "5"))
+	static bool BinHistogram2DInt(UPARAM(ref) FImPlotBinnedGrid& Grid, const TArray<int32>& xs, const TArray<int32>& ys, FVector2D X_Range, FVector2D Y_Range,
+		UPARAM(meta=(Bitmask, BitmaskEnum=EImPlotBin)) int32 x_bins = -2, UPARAM(meta=(Bitmask, BitmaskEnum=EImPlotBin)) int32 y_bins = -2, bool density = false, bool outliers = true, int32 DataVersion = 0)
+	{
+		return FImPlotBinning::Histogram2D(Grid, xs.GetData(), ys.GetData(), FMath::Min(xs.Num(), ys.Num()), x_bins, y_bins, density, ImPlotLimits(X_Range.X, X_Range.Y, Y_Range.X, Y_Range.Y), outliers, DataVersion);
+	}
+
+	// Plots a binned grid as a heatmap. Leave #scale_min and #scale_max both at 0 to scale from 0 to the largest bin. #label_fmt can be empty for no labels.
+	UFUNCTION(BlueprintCallable, Category = "ImPlot|Binning", meta = (AdvancedDisplay = "2"))
+	static void PlotBinnedGrid(const FString& label_id, UPARAM(ref) FImPlotBinnedGrid& Grid, float scale_min = 0.0f, float scale_max = 0.0f, FString label_fmt = TEXT(""))
+	{
+		if (Grid.Values.Num() == 0)
+			return;
+
+		const bool bAutoScale = scale_min == 0.0f && scale_max == 0.0f;
+		ImPlot::PlotHeatmap<float>(TCHAR_TO_ANSI(*label_id), Grid.Values.GetData(), Grid.Rows, Grid.Cols,
+			bAutoScale ? 0.0f : scale_min, bAutoScale ? Grid.MaxValue : scale_max,
+			label_fmt.Len() > 0 ? TCHAR_TO_ANSI(*label_fmt) : nullptr,
+			ImPlotPoint(Grid.Bounds.X.Min, Grid.Bounds.Y.Min), ImPlotPoint(Grid.Bounds.X.Max, Grid.Bounds.Y.Max));
+	}
+
+	// Cached replacement for PlotHistogram2DFloat: re-bins only when the inputs change, then plots the grid. The largest bin count or density is returned.
+	UFUNCTION(BlueprintCallable, Category = "ImPlot|Binning", Meta = (ReturnDisplayName = "Value", AdvancedDisplay = "6"))
+	static float PlotHistogram2DFloatCached(const FString& label_id, UPARAM(ref) FImPlotBinnedGrid& Grid, const TArray<float>& xs, const TArray<float>& ys, FVector2D X_Range, FVector2D Y_Range,
+		UPARAM(meta=(Bitmask, BitmaskEnum=EImPlotBin)) int32 x_bins = -2, UPARAM(meta=(Bitmask, BitmaskEnum=EImPlotBin)) int32 y_bins = -2, bool density = false, bool outliers = true, int32 DataVersion = 0)
+	{
+		BinHistogram2DFloat(Grid, xs, ys, X_Range, Y_Range, x_bins, y_bins, density, outliers, DataVersion);
+		PlotBinnedGrid(label_id, Grid);
+		return Grid.MaxValue;
+	}
+
+	// Cached replacement for PlotHistogram2DInt: re-bins only when the inputs change, then plots the grid. The largest bin count or density is returned.
+	UFUNCTION(BlueprintCallable, Category = "ImPlot|Binning", Meta = (ReturnDisplayName = "Value", AdvancedDisplay = "6"))
+	static float PlotHistogram2DIntCached(const FString& label_id, UPARAM(ref) FImPlotBinnedGrid& Grid, const TArray<int32>& xs, const TArray<int32>& ys, FVector2D X_Range, FVector2D Y_Range,
+		UPARAM(meta=(Bitmask, BitmaskEnum=EImPlotBin)) int32 x_bins = -2, UPARAM(meta=(Bitmask, BitmaskEnum=EImPlotBin)) int32 y_bins = -2, bool density = false, bool outliers = true, int32 DataVersion = 0)
+	{
+		BinHistogram2DInt(Grid, xs, ys, X_Range, Y_Range, x_bins, y_bins, density, outliers, DataVersion);
+		PlotBinnedGrid(label_id, Grid);
+		return Grid.MaxValue;
+	}
+
+	// Forces the next binning call on #Grid to re-bin.
+	UFUNCTION(BlueprintCallable, Category = "ImPlot|Binning")
+	static void InvalidateBinnedGrid(UPARAM(ref) FImPlotBinnedGrid& Grid) { Grid.Invalidate(); }
+};
@@ -0,0 +1,34 @@
+// Distributed under the MIT License (MIT) (see accompanying LICENSE file)
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Async/TaskGraphInterfaces.h"
+
+// Helpers shared by the cached plotting paths (binning, rasterized heatmaps, ...)
+namespace ImPlotCache
+{
+	// Cheap content fingerprint over a fixed number of evenly spaced samples (plus the last one).
+	// It does not replace an explicit data version, but catches most in place edits and appends.
+	template<typename T>
+	uint32 SampleFingerprint(const T* Data, int32 Count, int32 NumSamples = 64)
+	{
+		uint32 Hash = GetTypeHash(Count);
+		if (Data == nullptr || Count <= 0)
+			return Hash;
+
+		const int32 Step = FMath::Max(1, Count / FMath::Max(1, NumSamples));
+		for (int32 i = 0; i < Count; i += Step)
+		{
+			Hash = HashCombine(Hash, GetTypeHash(Data[i]));
+		}
+		return HashCombine(Hash, GetTypeHash(Data[Count - 1]));
+	}
+
+	// Splits #Count items into tasks of at least #MinItems, bounded by the number of worker threads.
+	inline int32 GetNumTasks(int32 Count, int32 MinItems)
+	{
+		const int32 MaxTasks = FMath::Max(1, FTaskGraphInterface::Get().GetNumWorkerThreads() + 1);
+		return FMath::Clamp(Count / FMath::Max(1, MinItems), 1, MaxTasks);
+	}
+}
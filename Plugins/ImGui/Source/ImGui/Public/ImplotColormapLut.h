@@ -0,0 +1,46 @@
+// Distributed under the MIT License (MIT) (see accompanying LICENSE file)
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include <implot.h>
+
+// Colormap sampled at evenly spaced points, in the formats the batch samplers write.
+struct FImPlotColormapTable
+{
+	TArray<FColor> Colors;
+	TArray<FLinearColor> LinearColors;
+	TArray<ImU32> PackedColors;
+
+	int32 Num() const { return Colors.Num(); }
+};
+
+/*
+ * Lookup tables for batch colormap sampling. Tables are built once per (colormap, size), either
+ * up front when the colormap is pushed or on first use, and dropped when the ImPlot context changes.
+ * The samplers map values to table indices four at a time and gather the colors from the table.
+ */
+class IMGUI_API FImPlotColormapLut
+{
+public:
+
+	static constexpr int32 DefaultSize = 256;
+	static constexpr int32 HighResSize = 1024;
+
+	// Returns the table of #Colormap (< 0 for the current colormap) with #Size entries, building it if needed.
+	static const FImPlotColormapTable& Get(int32 Colormap = -1, int32 Size = DefaultSize);
+
+	// Builds the default and high resolution tables of #Colormap (< 0 for the current colormap) ahead of use.
+	static void Prepare(int32 Colormap = -1);
+
+	// Maps #Count values from [ScaleMin, ScaleMax] to colors. Values outside the range are clamped, NaN maps to the first color.
+	static void Sample(const float* Values, int32 Count, float ScaleMin, float ScaleMax, FColor* Out, int32 Colormap = -1, int32 Size = DefaultSize);
+	static void Sample(const float* Values, int32 Count, float ScaleMin, float ScaleMax, FLinearColor* Out, int32 Colormap = -1, int32 Size = DefaultSize);
+	static void Sample(const float* Values, int32 Count, float ScaleMin, float ScaleMax, ImU32* Out, int32 Colormap = -1, int32 Size = DefaultSize);
+
+	// Drops all tables, e.g. after colormaps were added to a new context.
+	static void Reset();
+
+	// Minimum number of values handled by a single parallel task.
+	static constexpr int32 MinValuesPerTask = 16 * 1024;
+};
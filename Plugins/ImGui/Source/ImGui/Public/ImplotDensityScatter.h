@@ -0,0 +1,111 @@
+// Distributed under the MIT License (MIT) (see accompanying LICENSE file)
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Kismet/BlueprintFunctionLibrary.h"
+#include <implot.h>
+
+#include "ImplotHeatmapImage.h"
+#include "ImplotDensityScatter.generated.h"
+
+// Scatter plot drawn as a density image: the points are counted per screen pixel and the counts
+// are mapped through a colormap, so the cost depends on the plot size rather than on the point count.
+USTRUCT(BlueprintType)
+struct FImPlotScatterDensity
+{
+	GENERATED_BODY()
+
+	// texture and pixels of the density image
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
+	FImPlotHeatmapImage Image;
+
+	// largest number of points that fell into one pixel
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
+	int32 MaxCount = 0;
+
+	// number of points inside the current plot limits
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
+	int32 VisibleCount = 0;
+
+	TArray<uint32> Counts;
+
+	// cache key of the last splat
+	const void* CachedXs = nullptr;
+	const void* CachedYs = nullptr;
+	int32 CachedCount = -1;
+	int32 CachedStride = 0;
+	int32 CachedVersion = 0;
+	uint32 CachedFingerprint = 0;
+	ImPlotLimits CachedLimits;
+	bool bCachedLogX = false;
+	bool bCachedLogY = false;
+	int32 CachedColormap = -1;
+	bool bCachedLogScale = false;
+
+	// Forces the next call to splat again.
+	void Invalidate() { CachedCount = -1; }
+};
+
+/*
+ * Splats points into a count buffer at the resolution of the current plot, using the plot's pixel
+ * transform (log10 on log axes, where non-positive values are dropped like ImPlot does). Points are
+ * counted in parallel into per-task buffers that are summed afterwards. The splat is skipped while
+ * the data, the plot limits and axis scales, the plot size and the colormap are unchanged.
+ */
+class IMGUI_API FImPlotDensityScatter
+{
+public:
+
+	// Splats #Count points read from #Xs and #Ys, #Stride bytes apart, and draws the density image over the current plot area.
+	// One texel covers #PixelSize x #PixelSize screen pixels. Must be called between BeginPlot and EndPlot.
+	static void Plot(const char* LabelId, FImPlotScatterDensity& Density, const float* Xs, const float* Ys, int32 Count, int32 Stride,
+		int32 Colormap = -1, bool bLogScale = true, int32 PixelSize = 1, int32 DataVersion = 0);
+
+	// Minimum number of points handled by a single parallel task.
+	static constexpr int32 MinPointsPerTask = 64 * 1024;
+};
+
+/*
+ *
+ */
+UCLASS()
+class IMGUI_API UImPlotDensityScatterFunction : public UBlueprintFunctionLibrary
+{
+	GENERATED_BODY()
+
+public:
+
+	// Density image replacement for PlotScatter, meant for very large point sets. The image covers the current plot limits, so set them
+	// explicitly (SetNextPlotLimits) rather than relying on auto-fit. Empty pixels are transparent. Bump #DataVersion when the arrays change in place.
+	UFUNCTION(BlueprintCallable, Category = "ImPlot|Scatter", meta = (AdvancedDisplay = "4"))
+	static void PlotScatterDensityFloat(const FString& label_id, UPARAM(ref) FImPlotScatterDensity& Density, const TArray<float>& xs, const TArray<float>& ys,
+		int32 colormap = -1, bool log_scale = true, int32 pixel_size = 1, int32 DataVersion = 0)
+	{
+		FImPlotDensityScatter::Plot(TCHAR_TO_ANSI(*label_id), Density, xs.GetData(), ys.GetData(), FMath::Min(xs.Num(), ys.Num()), sizeof(float),
+			colormap, log_scale, pixel_size, DataVersion);
+	}
+
+	UFUNCTION(BlueprintCallable, Category = "ImPlot|Scatter", meta = (AdvancedDisplay = "3"))
+	static void PlotScatterDensityVector2D(const FString& label_id, UPARAM(ref) FImPlotScatterDensity& Density, const TArray<FVector2D>& values,
+		int32 colormap = -1, bool log_scale = true, int32 pixel_size = 1, int32 DataVersion = 0)
+	{
+		const float* Data = reinterpret_cast<const float*>(values.GetData());
+		FImPlotDensityScatter::Plot(TCHAR_TO_ANSI(*label_id), Density, Data, Data + 1, values.Num(), sizeof(FVector2D),
+			colormap, log_scale, pixel_size, DataVersion);
+	}
+
+	// plots the X and Y components of #values, e.g. actor locations seen from the top
+	UFUNCTION(BlueprintCallable, Category = "ImPlot|Scatter", meta = (AdvancedDisplay = "3"))
+	static void PlotScatterDensityVector(const FString& label_id, UPARAM(ref) FImPlotScatterDensity& Density, const TArray<FVector>& values,
+		int32 colormap = -1, bool log_scale = true, int32 pixel_size = 1, int32 DataVersion = 0)
+	{
+		const float* Data = reinterpret_cast<const float*>(values.GetData());
+		FImPlotDensityScatter::Plot(TCHAR_TO_ANSI(*label_id), Density, Data, Data + 1, values.Num(), sizeof(FVector),
+			colormap, log_scale, pixel_size, DataVersion);
+	}
+
+	// Forces the next call on #Density to splat again.
+	UFUNCTION(BlueprintCallable, Category = "ImPlot|Scatter")
+	static void InvalidateScatterDensity(UPARAM(ref) FImPlotScatterDensity& Density) { Density.Invalidate(); }
+};
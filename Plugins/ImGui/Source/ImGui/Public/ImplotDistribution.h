@@ -0,0 +1,78 @@
+// Distributed under the MIT License (MIT) (see accompanying LICENSE file)
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Kismet/BlueprintFunctionLibrary.h"
+
+#include "ImplotDistribution.generated.h"
+
+UENUM(BlueprintType)
+enum class EImPlotDistribution : uint8
+{
+	Uniform,     // A = min, B = max
+	Normal,      // A = mean, B = standard deviation
+	Exponential, // A = rate (lambda)
+	LogNormal    // A = mean of the underlying normal, B = standard deviation of the underlying normal
+};
+
+/*
+ * Thread-safe random sample generator. Samples are produced in fixed size chunks, each with its own
+ * FRandomStream seeded from (Seed, chunk index), so the output only depends on the seed and the count,
+ * never on the number of worker threads. Uniforms are drawn in batches and transformed four at a time.
+ */
+class IMGUI_API FImPlotDistribution
+{
+public:
+
+	// Fills #Out with #Count samples of #Type. See EImPlotDistribution for the meaning of #A and #B.
+	static void Generate(TArray<float>& Out, EImPlotDistribution Type, int32 Count, int32 Seed, float A, float B);
+
+	// Same as Generate but writes into caller owned memory.
+	static void Generate(float* Out, EImPlotDistribution Type, int32 Count, int32 Seed, float A, float B);
+
+	// Number of samples produced by one chunk (and one FRandomStream).
+	static constexpr int32 ChunkSize = 16 * 1024;
+};
+
+/*
+ *
+ */
+UCLASS()
+class IMGUI_API UImPlotDistributionFunction : public UBlueprintFunctionLibrary
+{
+	GENERATED_BODY()
+
+public:
+
+	// Fills #Data with #Count samples. The same #Seed and #Count always produce the same samples.
+	UFUNCTION(BlueprintCallable, Category = "ImPlot|Distribution", meta = (AdvancedDisplay = "3"))
+	static void MakeDistribution(UPARAM(ref) TArray<float>& Data, EImPlotDistribution Type, int32 Count = 10000, int32 Seed = 0, float A = 0.0f, float B = 1.0f)
+	{
+		FImPlotDistribution::Generate(Data, Type, Count, Seed, A, B);
+	}
+
+	UFUNCTION(BlueprintCallable, Category = "ImPlot|Distribution", meta = (AdvancedDisplay = "2"))
+	static void MakeUniformDistribution(UPARAM(ref) TArray<float>& Data, int32 Count = 10000, int32 Seed = 0, float Min = 0.0f, float Max = 1.0f)
+	{
+		FImPlotDistribution::Generate(Data, EImPlotDistribution::Uniform, Count, Seed, Min, Max);
+	}
+
+	UFUNCTION(BlueprintCallable, Category = "ImPlot|Distribution", meta = (AdvancedDisplay = "2"))
+	static void MakeNormalDistribution(UPARAM(ref) TArray<float>& Data, int32 Count = 10000, int32 Seed = 0, float Mean = 0.0f, float StdDev = 1.0f)
+	{
+		FImPlotDistribution::Generate(Data, EImPlotDistribution::Normal, Count, Seed, Mean, StdDev);
+	}
+
+	UFUNCTION(BlueprintCallable, Category = "ImPlot|Distribution", meta = (AdvancedDisplay = "2"))
+	static void MakeExponentialDistribution(UPARAM(ref) TArray<float>& Data, int32 Count = 10000, int32 Seed = 0, float Lambda = 1.0f)
+	{
+		FImPlotDistribution::Generate(Data, EImPlotDistribution::Exponential, Count, Seed, Lambda, 0.0f);
+	}
+
+	UFUNCTION(BlueprintCallable, Category = "ImPlot|Distribution", meta = (AdvancedDisplay = "2"))
+	static void MakeLogNormalDistribution(UPARAM(ref) TArray<float>& Data, int32 Count = 10000, int32 Seed = 0, float Mu = 0.0f, float Sigma = 1.0f)
+	{
+		FImPlotDistribution::Generate(Data, EImPlotDistribution::LogNormal, Count, Seed, Mu, Sigma);
+	}
+};
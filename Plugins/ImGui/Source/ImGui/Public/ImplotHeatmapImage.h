@@ -0,0 +1,141 @@
+// Distributed under the MIT License (MIT) (see accompanying LICENSE file)
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Kismet/BlueprintFunctionLibrary.h"
+#include "Engine/Texture2D.h"
+#include <implot.h>
+
+#include "ImGuiModule.h"
+#include "ImplotBinning.h"
+#include "ImplotHeatmapImage.generated.h"
+
+// CPU rasterized heatmap. The cells are converted to colors on the CPU and uploaded to a transient
+// texture, which is drawn with a single PlotImage call instead of one rectangle per cell.
+USTRUCT(BlueprintType)
+struct FImPlotHeatmapImage
+{
+	GENERATED_BODY()
+
+	// transient BGRA8 texture holding the rasterized cells, recreated when the size changes.
+	// Its ImGui registration is dropped by FImGuiTextureCache once the texture is garbage collected.
+	UPROPERTY(Transient, VisibleAnywhere, BlueprintReadOnly)
+	UTexture2D* Texture = nullptr;
+
+	// size of the texture, smaller than the grid when cells are aggregated
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
+	int32 Width = 0;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
+	int32 Height = 0;
+
+	// scale actually used for the color mapping (resolved from the data when both were 0)
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
+	FVector2D Scale = FVector2D::ZeroVector;
+
+	FImGuiTextureHandle TextureHandle;
+	TArray<FColor> Pixels;
+
+	// cache key of the last rasterization
+	const void* CachedValues = nullptr;
+	int32 CachedRows = -1;
+	int32 CachedCols = -1;
+	int32 CachedVersion = 0;
+	uint32 CachedFingerprint = 0;
+	float CachedScaleMin = 0.0f;
+	float CachedScaleMax = 0.0f;
+	int32 CachedColormap = -1;
+	int32 CachedCellsX = 0;
+	int32 CachedCellsY = 0;
+
+	// Forces the next call to rasterize and upload again.
+	void Invalidate() { CachedRows = -1; }
+};
+
+/*
+ * Rasterizes heatmap grids on the CPU. Rows are converted to colors in parallel through a colormap
+ * lookup table and the texture is only updated when the data, the scale, the colormap or the
+ * aggregation factor change. When the grid has more cells than the plot has pixels, blocks of
+ * cells are averaged into one texel (power of two block sizes, so zooming does not re-raster every frame).
+ */
+class IMGUI_API FImPlotHeatmapRasterizer
+{
+public:
+
+	// Rasterizes a row-major grid (row 0 at the top) into #Image. At most #MaxWidth x #MaxHeight texels are produced (<= 0 for no limit).
+	// #Colormap < 0 uses the current colormap. Returns true if the texture was updated.
+	static bool Rasterize(FImPlotHeatmapImage& Image, const float* Values, int32 Rows, int32 Cols, float ScaleMin, float ScaleMax, int32 Colormap, int32 MaxWidth, int32 MaxHeight, int32 DataVersion = 0);
+	static bool Rasterize(FImPlotHeatmapImage& Image, const int32* Values, int32 Rows, int32 Cols, float ScaleMin, float ScaleMax, int32 Colormap, int32 MaxWidth, int32 MaxHeight, int32 DataVersion = 0);
+
+	// Uploads Image.Pixels (Width x Height) to the texture, creating and registering it if needed.
+	static void Upload(FImPlotHeatmapImage& Image);
+
+	// Pixel footprint of #Bounds in the current plot, clamped to the largest supported texture size. Must be called between BeginPlot and EndPlot.
+	static FIntPoint GetPixelFootprint(const ImPlotPoint& BoundsMin, const ImPlotPoint& BoundsMax);
+
+	// Draws the rasterized image over #Bounds in the current plot.
+	static void Plot(const char* LabelId, const FImPlotHeatmapImage& Image, const ImPlotPoint& BoundsMin, const ImPlotPoint& BoundsMax);
+
+	// Minimum number of texels converted by a single parallel task.
+	static constexpr int32 MinTexelsPerTask = 16 * 1024;
+};
+
+/*
+ *
+ */
+UCLASS()
+class IMGUI_API UImPlotHeatmapImageFunction : public UBlueprintFunctionLibrary
+{
+	GENERATED_BODY()
+
+public:
+
+	// Image based replacement for PlotHeatmapFloat, meant for large grids. Leave #scale_min and #scale_max both at 0 to use the data min/max.
+	// Cells smaller than a pixel are averaged. #colormap < 0 uses the current colormap. Bump #DataVersion whenever #values is modified in place.
+	UFUNCTION(BlueprintCallable, Category = "ImPlot|Heatmap", meta = (AdvancedDisplay = "5"))
+	static void PlotHeatmapImageFloat(const FString& label_id, UPARAM(ref) FImPlotHeatmapImage& Image, const TArray<float>& values, int32 rows, int32 cols,
+		float scale_min = 0.0f, float scale_max = 0.0f, FVector2D bounds_min = FVector2D(0, 0), FVector2D bounds_max = FVector2D(1, 1), int32 colormap = -1, int32 DataVersion = 0)
+	{
+		if (rows <= 0 || cols <= 0 || values.Num() < rows * cols)
+			return;
+
+		const ImPlotPoint BoundsMin(bounds_min.X, bounds_min.Y), BoundsMax(bounds_max.X, bounds_max.Y);
+		const FIntPoint Footprint = FImPlotHeatmapRasterizer::GetPixelFootprint(BoundsMin, BoundsMax);
+		FImPlotHeatmapRasterizer::Rasterize(Image, values.GetData(), rows, cols, scale_min, scale_max, colormap, Footprint.X, Footprint.Y, DataVersion);
+		FImPlotHeatmapRasterizer::Plot(TCHAR_TO_ANSI(*label_id), Image, BoundsMin, BoundsMax);
+	}
+
+	UFUNCTION(BlueprintCallable, Category = "ImPlot|Heatmap", meta = (AdvancedDisplay = "5"))
+	static void PlotHeatmapImageInt(const FString& label_id, UPARAM(ref) FImPlotHeatmapImage& Image, const TArray<int32>& values, int32 rows, int32 cols,
+		float scale_min = 0.0f, float scale_max = 0.0f, FVector2D bounds_min = FVector2D(0, 0), FVector2D bounds_max = FVector2D(1, 1), int32 colormap = -1, int32 DataVersion = 0)
+	{
+		if (rows <= 0 || cols <= 0 || values.Num() < rows * cols)
+			return;
+
+		const ImPlotPoint BoundsMin(bounds_min.X, bounds_min.Y), BoundsMax(bounds_max.X, bounds_max.Y);
+		const FIntPoint Footprint = FImPlotHeatmapRasterizer::GetPixelFootprint(BoundsMin, BoundsMax);
+		FImPlotHeatmapRasterizer::Rasterize(Image, values.GetData(), rows, cols, scale_min, scale_max, colormap, Footprint.X, Footprint.Y, DataVersion);
+		FImPlotHeatmapRasterizer::Plot(TCHAR_TO_ANSI(*label_id), Image, BoundsMin, BoundsMax);
+	}
+
+	// Image based replacement for PlotBinnedGrid. Leave #scale_min and #scale_max both at 0 to scale from 0 to the largest bin.
+	UFUNCTION(BlueprintCallable, Category = "ImPlot|Heatmap", meta = (AdvancedDisplay = "3"))
+	static void PlotBinnedGridImage(const FString& label_id, UPARAM(ref) FImPlotHeatmapImage& Image, UPARAM(ref) FImPlotBinnedGrid& Grid, float scale_min = 0.0f, float scale_max = 0.0f, int32 colormap = -1)
+	{
+		if (Grid.Values.Num() == 0)
+			return;
+
+		const bool bAutoScale = scale_min == 0.0f && scale_max == 0.0f;
+		const ImPlotPoint BoundsMin(Grid.Bounds.X.Min, Grid.Bounds.Y.Min), BoundsMax(Grid.Bounds.X.Max, Grid.Bounds.Y.Max);
+		const FIntPoint Footprint = FImPlotHeatmapRasterizer::GetPixelFootprint(BoundsMin, BoundsMax);
+		// the grid only changes when it is re-binned, so its revision doubles as the data version
+		FImPlotHeatmapRasterizer::Rasterize(Image, Grid.Values.GetData(), Grid.Rows, Grid.Cols,
+			bAutoScale ? 0.0f : scale_min, bAutoScale ? Grid.MaxValue : scale_max, colormap, Footprint.X, Footprint.Y, Grid.Revision);
+		FImPlotHeatmapRasterizer::Plot(TCHAR_TO_ANSI(*label_id), Image, BoundsMin, BoundsMax);
+	}
+
+	// Forces the next call on #Image to rasterize and upload again.
+	UFUNCTION(BlueprintCallable, Category = "ImPlot|Heatmap")
+	static void InvalidateHeatmapImage(UPARAM(ref) FImPlotHeatmapImage& Image) { Image.Invalidate(); }
+};
@@ -0,0 +1,146 @@
+// Distributed under the MIT License (MIT) (see accompanying LICENSE file)
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Kismet/BlueprintFunctionLibrary.h"
+#include "Misc/Paths.h"
+#include <implot.h>
+
+#include "ImplotMappedSeries.generated.h"
+
+class IMappedFileHandle;
+class IMappedFileRegion;
+
+/*
+ * Columnar series file, little endian:
+ *   header (FImPlotSeriesFileHeader, 32 bytes)
+ *   NumColumns column names, NameSize bytes each, UTF-8, zero padded
+ *   NumColumns columns of NumRows values (float or double), starting at DataOffset, one after the other
+ * Column 0 holds the X values (e.g. time) and must be sorted in ascending order.
+ */
+struct FImPlotSeriesFileHeader
+{
+	static constexpr uint32 MagicValue = 0x46535049; // "IPSF"
+	static constexpr uint32 CurrentVersion = 1;
+	static constexpr int32 NameSize = 64;
+
+	uint32 Magic = MagicValue;
+	uint32 Version = CurrentVersion;
+	uint32 NumColumns = 0;
+	uint32 ValueSize = sizeof(float); // 4 (float) or 8 (double)
+	uint64 NumRows = 0;
+	uint64 DataOffset = 0;
+};
+static_assert(sizeof(FImPlotSeriesFileHeader) == 32, "Series file header layout changed");
+
+/*
+ * Series file memory mapped through the platform file layer. Opening only reads the header and the names
+ * and maps the column data, so it takes the same time for any file size; the OS pages the data in as the
+ * plot touches it. Plotting binary searches the visible X range and strides through it so that at most
+ * a few points per pixel are drawn, straight from the mapping.
+ */
+class IMGUI_API FImPlotMappedSeriesFile
+{
+public:
+
+	~FImPlotMappedSeriesFile();
+
+	// Returns nullptr if the file cannot be mapped or is not a valid series file.
+	static TSharedPtr<FImPlotMappedSeriesFile> Open(const FString& Filename);
+
+	// Writes a float series file. #Columns[0] is the X column, all columns must have the same length.
+	static bool Write(const FString& Filename, const TArray<FString>& Names, const TArray<TArray<float>>& Columns);
+
+	// Plots column #Column against column 0 over the visible X range, with about #MaxPoints points (<= 0 for two per pixel).
+	void PlotLine(const char* LabelId, int32 Column, int32 MaxPoints = 0) const;
+	void PlotScatter(const char* LabelId, int32 Column, int32 MaxPoints = 0) const;
+
+	int64 GetNumRows() const { return (int64)Header.NumRows; }
+	int32 GetNumColumns() const { return (int32)Header.NumColumns; }
+	const TArray<FString>& GetNames() const { return Names; }
+	const FString& GetFilename() const { return Filename; }
+
+	// First and last X value.
+	FVector2D GetXRange() const;
+
+	// Value of #Column at #Row as double.
+	double GetValue(int32 Column, int64 Row) const;
+
+private:
+
+	FImPlotMappedSeriesFile() = default;
+
+	// Visible row range and stride for the current plot.
+	bool GetVisibleRows(int32 MaxPoints, int64& OutStart, int64& OutCount, int32& OutStride) const;
+
+	template<typename T>
+	void PlotColumn(const char* LabelId, int32 Column, int32 MaxPoints, bool bScatter) const;
+
+	const uint8* GetColumn(int32 Column) const { return Data + (int64)Column * Header.NumRows * Header.ValueSize; }
+
+	FString Filename;
+	FImPlotSeriesFileHeader Header;
+	TArray<FString> Names;
+
+	TUniquePtr<IMappedFileHandle> FileHandle;
+	TUniquePtr<IMappedFileRegion> Region;
+	const uint8* Data = nullptr;
+};
+
+// Blueprint handle to a mapped series file. Copies of the struct share the same mapping.
+USTRUCT(BlueprintType)
+struct FImPlotMappedSeries
+{
+	GENERATED_BODY()
+
+	TSharedPtr<FImPlotMappedSeriesFile> File;
+
+	bool IsValid() const { return File.IsValid(); }
+};
+
+/*
+ *
+ */
+UCLASS()
+class IMGUI_API UImPlotMappedSeriesFunction : public UBlueprintFunctionLibrary
+{
+	GENERATED_BODY()
+
+public:
+
+	// Maps a series file. Relative paths are relative to the project directory.
+	UFUNCTION(BlueprintCallable, Category = "ImPlot|MappedSeries")
+	static bool OpenMappedSeries(const FString& Filename, FImPlotMappedSeries& Series)
+	{
+		const FString FullPath = FPaths::IsRelative(Filename) ? FPaths::Combine(FPaths::ProjectDir(), Filename) : Filename;
+		Series.File = FImPlotMappedSeriesFile::Open(FullPath);
+		return Series.IsValid();
+	}
+
+	UFUNCTION(BlueprintCallable, Category = "ImPlot|MappedSeries")
+	static void CloseMappedSeries(UPARAM(ref) FImPlotMappedSeries& Series) { Series.File.Reset(); }
+
+	UFUNCTION(BlueprintPure, Category = "ImPlot|MappedSeries")
+	static void GetMappedSeriesInfo(const FImPlotMappedSeries& Series, int64& NumRows, TArray<FString>& ColumnNames, FVector2D& XRange)
+	{
+		NumRows = Series.IsValid() ? Series.File->GetNumRows() : 0;
+		ColumnNames = Series.IsValid() ? Series.File->GetNames() : TArray<FString>();
+		XRange = Series.IsValid() ? Series.File->GetXRange() : FVector2D::ZeroVector;
+	}
+
+	// Plots #column against the X column for the visible range only. #max_points <= 0 draws about two points per pixel.
+	UFUNCTION(BlueprintCallable, Category = "ImPlot|MappedSeries", meta = (AdvancedDisplay = "3"))
+	static void PlotMappedSeriesLine(const FString& label_id, const FImPlotMappedSeries& Series, int32 column = 1, int32 max_points = 0)
+	{
+		if (Series.IsValid())
+			Series.File->PlotLine(TCHAR_TO_ANSI(*label_id), column, max_points);
+	}
+
+	UFUNCTION(BlueprintCallable, Category = "ImPlot|MappedSeries", meta = (AdvancedDisplay = "3"))
+	static void PlotMappedSeriesScatter(const FString& label_id, const FImPlotMappedSeries& Series, int32 column = 1, int32 max_points = 0)
+	{
+		if (Series.IsValid())
+			Series.File->PlotScatter(TCHAR_TO_ANSI(*label_id), column, max_points);
+	}
+};
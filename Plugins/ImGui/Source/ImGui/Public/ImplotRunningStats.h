@@ -0,0 +1,154 @@
+// Distributed under the MIT License (MIT) (see accompanying LICENSE file)
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "ImplotRunningStats.generated.h"
+
+/*
+ * Min, max, mean and variance of a sliding window of values, updated in O(1) amortized per sample.
+ * Values enter at the back with Push and leave at the front with Pop (the caller passes the value that
+ * leaves, the buffers already have it at hand). Min and max come from monotonic queues, mean and
+ * variance from sums shifted by the first value of the window to limit cancellation.
+ */
+class FImPlotRunningStats
+{
+public:
+
+	void Reset()
+	{
+		MinQueue.Reset();
+		MaxQueue.Reset();
+		FirstSeq = NextSeq = 0;
+		Shift = Sum = SumSq = 0.0;
+	}
+
+	void Push(float Value)
+	{
+		if (Num() == 0)
+		{
+			Shift = Value;
+			Sum = SumSq = 0.0;
+		}
+		const double Delta = (double)Value - Shift;
+		Sum += Delta;
+		SumSq += Delta * Delta;
+		MinQueue.Push(NextSeq, Value, [](float Back, float New) { return Back >= New; });
+		MaxQueue.Push(NextSeq, Value, [](float Back, float New) { return Back <= New; });
+		++NextSeq;
+	}
+
+	// Removes the oldest value of the window, #Value must be that value.
+	void Pop(float Value)
+	{
+		if (Num() == 0)
+			return;
+
+		++FirstSeq;
+		if (Num() == 0)
+		{
+			Reset();
+			return;
+		}
+		const double Delta = (double)Value - Shift;
+		Sum -= Delta;
+		SumSq -= Delta * Delta;
+		MinQueue.EvictBefore(FirstSeq);
+		MaxQueue.EvictBefore(FirstSeq);
+	}
+
+	int32 Num() const { return (int32)(NextSeq - FirstSeq); }
+
+	float GetMin() const { return Num() > 0 ? MinQueue.Front() : 0.0f; }
+	float GetMax() const { return Num() > 0 ? MaxQueue.Front() : 0.0f; }
+	float GetMean() const { return Num() > 0 ? (float)(Shift + Sum / Num()) : 0.0f; }
+
+	// Population variance.
+	float GetVariance() const
+	{
+		if (Num() == 0)
+			return 0.0f;
+		const double Mean = Sum / Num();
+		return (float)FMath::Max(0.0, SumSq / Num() - Mean * Mean);
+	}
+
+private:
+
+	// Deque of (sequence, value) where no entry is dominated by a later one, so the front is the extreme.
+	struct FMonotonicQueue
+	{
+		TArray<TPair<int64, float>> Items;
+		int32 Head = 0;
+
+		void Reset()
+		{
+			Items.Reset();
+			Head = 0;
+		}
+
+		template<typename PredicateType>
+		void Push(int64 Seq, float Value, PredicateType IsDominated)
+		{
+			while (Items.Num() > Head && IsDominated(Items.Last().Value, Value))
+			{
+				Items.Pop(false);
+			}
+			Items.Emplace(Seq, Value);
+		}
+
+		void EvictBefore(int64 Seq)
+		{
+			while (Head < Items.Num() && Items[Head].Key < Seq)
+			{
+				++Head;
+			}
+			// compact once the dead prefix dominates, keeps Push and Pop amortized O(1)
+			if (Head > 32 && Head * 2 > Items.Num())
+			{
+				Items.RemoveAt(0, Head, false);
+				Head = 0;
+			}
+		}
+
+		float Front() const { return Items[Head].Value; }
+	};
+
+	FMonotonicQueue MinQueue;
+	FMonotonicQueue MaxQueue;
+	int64 FirstSeq = 0;
+	int64 NextSeq = 0;
+	double Shift = 0.0;
+	double Sum = 0.0;
+	double SumSq = 0.0;
+};
+
+// Statistics of one axis of a plot buffer.
+USTRUCT(BlueprintType)
+struct FImPlotSeriesStats
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	int32 Count = 0;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	float Min = 0.0f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	float Max = 0.0f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	float Mean = 0.0f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	float Variance = 0.0f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	float StdDev = 0.0f;
+
+	FImPlotSeriesStats() { }
+	FImPlotSeriesStats(const FImPlotRunningStats& Stats)
+		: Count(Stats.Num()), Min(Stats.GetMin()), Max(Stats.GetMax()), Mean(Stats.GetMean()), Variance(Stats.GetVariance())
+		, StdDev(FMath::Sqrt(Variance)) { }
+};
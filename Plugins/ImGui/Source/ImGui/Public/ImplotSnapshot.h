@@ -0,0 +1,149 @@
+// Distributed under the MIT License (MIT) (see accompanying LICENSE file)
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Kismet/BlueprintFunctionLibrary.h"
+#include "HAL/CriticalSection.h"
+#include <implot.h>
+
+#include "ImplotWrapperFunctionLibrary.h"
+#include "ImplotSnapshot.generated.h"
+
+/*
+ * Shared state of a snapshot buffer. Producers append to the back buffer (any thread) and Commit
+ * publishes a copy of it as the pending snapshot. Once per frame, FImPlotSnapshotRegistry::FlipAll
+ * makes the pending snapshot the front buffer, which plot calls read for the rest of the frame.
+ * The flip and the publish are pointer swaps under a short lock; the copy happens on the producer side.
+ */
+class IMGUI_API FImPlotSnapshotState
+{
+public:
+
+	explicit FImPlotSnapshotState(int32 MaxSize);
+
+	// Producer side, safe from any thread.
+	void AddPoint(float X, float Y);
+	void AddPoints(const float* Xs, const float* Ys, int32 Count);
+	void Erase();
+	void Commit();
+
+	// Game thread side. Returns true if a new snapshot became the front buffer.
+	bool Flip();
+
+	// Immutable until the next flip. Game thread only.
+	const FScrollingBuffer& GetFront() const { return *Front; }
+
+private:
+
+	// guards Back and Spare (producers)
+	FCriticalSection ProducerLock;
+	FScrollingBuffer Back;
+	TUniquePtr<FScrollingBuffer> Spare;
+
+	// guards Pending and bHasPending (publish / flip)
+	FCriticalSection SwapLock;
+	TUniquePtr<FScrollingBuffer> Pending;
+	bool bHasPending = false;
+
+	TUniquePtr<FScrollingBuffer> Front;
+};
+
+// Flips every live snapshot buffer once per frame.
+class IMGUI_API FImPlotSnapshotRegistry
+{
+public:
+
+	// The first registration binds FlipAll to the start of the engine frame. Game thread only.
+	static void Register(const TSharedRef<FImPlotSnapshotState, ESPMode::ThreadSafe>& State);
+
+	// Called at the start of each engine frame, before any world or ImGui tick. Subsequent calls in the same frame do nothing.
+	static void FlipAll();
+};
+
+// Blueprint handle to a double buffered scrolling buffer. Copies of the struct share the same buffers.
+USTRUCT(BlueprintType)
+struct FImPlotSnapshotBuffer
+{
+	GENERATED_BODY()
+
+	TSharedPtr<FImPlotSnapshotState, ESPMode::ThreadSafe> State;
+
+	bool IsValid() const { return State.IsValid(); }
+};
+
+/*
+ *
+ */
+UCLASS()
+class IMGUI_API UImPlotSnapshotFunction : public UBlueprintFunctionLibrary
+{
+	GENERATED_BODY()
+
+public:
+
+	UFUNCTION(BlueprintCallable, Category = "ImPlot|Snapshot")
+	static void MakeSnapshotBuffer(UPARAM(ref) FImPlotSnapshotBuffer& buffer, int32 MaxSize = 2000)
+	{
+		const TSharedRef<FImPlotSnapshotState, ESPMode::ThreadSafe> State = MakeShared<FImPlotSnapshotState, ESPMode::ThreadSafe>(MaxSize);
+		FImPlotSnapshotRegistry::Register(State);
+		buffer.State = State;
+	}
+
+	// Appends to the back buffer. Nothing becomes visible before CommitSnapshot.
+	UFUNCTION(BlueprintCallable, Category = "ImPlot|Snapshot")
+	static void SnapshotAddPoint(UPARAM(ref) FImPlotSnapshotBuffer& buffer, float x, float y)
+	{
+		if (buffer.IsValid())
+			buffer.State->AddPoint(x, y);
+	}
+
+	UFUNCTION(BlueprintCallable, Category = "ImPlot|Snapshot")
+	static void SnapshotErase(UPARAM(ref) FImPlotSnapshotBuffer& buffer)
+	{
+		if (buffer.IsValid())
+			buffer.State->Erase();
+	}
+
+	// Publishes the back buffer. It becomes visible to the plot nodes at the start of the next frame.
+	UFUNCTION(BlueprintCallable, Category = "ImPlot|Snapshot")
+	static void CommitSnapshot(UPARAM(ref) FImPlotSnapshotBuffer& buffer)
+	{
+		if (buffer.IsValid())
+			buffer.State->Commit();
+	}
+
+	// Copy of the front buffer, for use with the regular plot nodes.
+	UFUNCTION(BlueprintPure, Category = "ImPlot|Snapshot")
+	static FScrollingBuffer GetSnapshotFront(const FImPlotSnapshotBuffer& buffer)
+	{
+		return buffer.IsValid() ? buffer.State->GetFront() : FScrollingBuffer();
+	}
+
+	UFUNCTION(BlueprintCallable, Category = "ImPlot|Snapshot")
+	static void PlotLineSnapshot(const FString& label_id, const FImPlotSnapshotBuffer& buffer)
+	{
+		if (!buffer.IsValid())
+			return;
+		const FScrollingBuffer& Front = buffer.State->GetFront();
+		ImPlot::PlotLine(TCHAR_TO_ANSI(*label_id), Front.DataX.GetData(), Front.DataY.GetData(), Front.DataX.Num(), Front.Offset, sizeof(float));
+	}
+
+	UFUNCTION(BlueprintCallable, Category = "ImPlot|Snapshot")
+	static void PlotScatterSnapshot(const FString& label_id, const FImPlotSnapshotBuffer& buffer)
+	{
+		if (!buffer.IsValid())
+			return;
+		const FScrollingBuffer& Front = buffer.State->GetFront();
+		ImPlot::PlotScatter(TCHAR_TO_ANSI(*label_id), Front.DataX.GetData(), Front.DataY.GetData(), Front.DataX.Num(), Front.Offset, sizeof(float));
+	}
+
+	UFUNCTION(BlueprintCallable, Category = "ImPlot|Snapshot")
+	static void PlotShadedSnapshot(const FString& label_id, const FImPlotSnapshotBuffer& buffer, float y_ref = 0)
+	{
+		if (!buffer.IsValid())
+			return;
+		const FScrollingBuffer& Front = buffer.State->GetFront();
+		ImPlot::PlotShaded(TCHAR_TO_ANSI(*label_id), Front.DataX.GetData(), Front.DataY.GetData(), Front.DataX.Num(), y_ref, Front.Offset, sizeof(float));
+	}
+};
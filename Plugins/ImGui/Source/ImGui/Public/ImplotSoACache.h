@@ -0,0 +1,51 @@
+// Distributed under the MIT License (MIT) (see accompanying LICENSE file)
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+// Per component view of a vector array: X[i * Stride], Y[i * Stride], Z[i * Stride] (Stride in bytes).
+struct FImPlotSoAView
+{
+	const float* X = nullptr;
+	const float* Y = nullptr;
+	const float* Z = nullptr; // nullptr for FVector2D arrays
+	int32 Num = 0;
+	int32 Stride = sizeof(float);
+
+	// Component wise bounds of all values (Z is 0 for FVector2D arrays).
+	FVector Min = FVector::ZeroVector;
+	FVector Max = FVector::ZeroVector;
+};
+
+/*
+ * Structure of arrays copies of the FVector / FVector2D arrays passed to the plot wrappers, so each
+ * series is plotted from a contiguous array instead of a strided pass over the whole vector array.
+ * Only arrays given a data version are copied: the copy is built with a SIMD transpose and reused while
+ * the address, size and version stay the same (the sampled content is checked as well), so the caller
+ * bumps the version when it modifies the array. Copies not used for a while are dropped. Arrays without
+ * a version, and small arrays, are plotted in place. Game thread only.
+ */
+class IMGUI_API FImPlotSoACache
+{
+public:
+
+	// Arrays below this size are not copied, the view points into the array itself.
+	static constexpr int32 MinCount = 1024;
+
+	// #DataVersion < 0 returns a view into #Values itself.
+	static FImPlotSoAView Get(const TArray<FVector>& Values, int32 DataVersion = -1);
+	static FImPlotSoAView Get(const TArray<FVector2D>& Values, int32 DataVersion = -1);
+
+	// Transposes #Count vectors into per component arrays, returns their bounds.
+	static void Transpose(const FVector* Values, int32 Count, float* OutX, float* OutY, float* OutZ, FVector& OutMin, FVector& OutMax);
+	static void Transpose(const FVector2D* Values, int32 Count, float* OutX, float* OutY, FVector& OutMin, FVector& OutMax);
+
+	static void Reset();
+
+	// Minimum number of vectors handled by a single parallel task.
+	static constexpr int32 MinValuesPerTask = 32 * 1024;
+
+	// Copies unused for this many frames are dropped.
+	static constexpr uint64 MaxUnusedFrames = 120;
+};
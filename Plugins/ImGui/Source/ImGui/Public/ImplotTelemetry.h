@@ -0,0 +1,271 @@
+// Distributed under the MIT License (MIT) (see accompanying LICENSE file)
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Kismet/BlueprintFunctionLibrary.h"
+#include "HAL/ThreadSafeBool.h"
+
+#include "ImplotWrapperFunctionLibrary.h"
+#include "ImplotTelemetry.generated.h"
+
+/*
+ * Telemetry files are a stream of records after an 8 byte header ("IPTR", version):
+ *   channel record: type 0, channel index, UTF-8 name
+ *   chunk record:   type 1, channel index, sample count, X min/max, raw and stored size, then the samples
+ *                   as two columns (all X, then all Y), zlib compressed unless that did not make them smaller
+ * There is no footer, so a file cut short by a crash is still readable up to its last complete record.
+ */
+namespace ImPlotTelemetry
+{
+	constexpr uint32 Magic = 0x52545049; // "IPTR"
+	constexpr uint32 Version = 1;
+}
+
+class FImPlotTelemetryWriter;
+
+/*
+ * Records channels of (x, y) samples to a telemetry file. Samples are staged per channel on the game
+ * thread and handed over in chunks to a writer thread, which opens the file, compresses and writes.
+ * Memory is bounded: when more than MaxPendingChunks chunks wait for the disk, new chunks are dropped
+ * (and counted) instead of blocking the frame. Stopping never waits for the disk either, the writer
+ * finishes on its own and is joined later (at the latest before exit). Game thread only.
+ */
+class IMGUI_API FImPlotTelemetryRecorder
+{
+public:
+
+	FImPlotTelemetryRecorder(const FString& Filename, int32 ChunkSamples, int32 MaxPendingChunks);
+	~FImPlotTelemetryRecorder();
+
+	void Record(FName Channel, float X, float Y);
+
+	// Records the samples of #Buffer that are newer than the last recorded one (X must grow).
+	void RecordScrollingBuffer(FName Channel, const FScrollingBuffer& Buffer);
+
+	// Records the samples added to #Buffer since the last call, with X restored from the wrapped value.
+	// Call it at least once per span, or wraps cannot be told apart.
+	void RecordRollingBuffer(FName Channel, const FRollingBuffer& Buffer);
+
+	// Hands all partially filled chunks to the writer.
+	void Flush();
+
+	// Flushes and lets the writer write what is queued and close the file in the background. Later samples are dropped.
+	void Stop();
+
+	int32 GetWrittenChunks() const;
+	int32 GetDroppedChunks() const;
+	int32 GetPendingChunks() const;
+	bool HasFailed() const;
+
+private:
+
+	struct FChannel
+	{
+		int32 Index = 0;
+		TArray<float> X;
+		TArray<float> Y;
+		double LastX = TNumericLimits<double>::Lowest();
+
+		// rolling buffer tracking
+		int32 RollingNum = 0;
+		float RollingLastX = 0.0f;
+		double RollingBase = 0.0;
+	};
+
+	FChannel& FindOrAddChannel(FName Channel);
+	void Append(FChannel& State, float X, float Y);
+	void Submit(FChannel& State);
+
+	int32 ChunkSamples;
+	int32 MaxPendingChunks;
+
+	TMap<FName, FChannel> Channels;
+
+	// shared with the retired writers once stopped, so the recorder can go while the file is still being written
+	TSharedPtr<FImPlotTelemetryWriter, ESPMode::ThreadSafe> Writer;
+};
+
+/*
+ * Reads a telemetry file back. The chunk index is built on a background task when the file is opened,
+ * and chunks are loaded and decompressed on background tasks when a time window first needs them, so
+ * scrubbing never reads the file on the game thread; missing chunks show up a frame or two later.
+ * Decoded chunks are kept in a cache bounded by MaxCachedChunks, least recently used first out.
+ */
+class IMGUI_API FImPlotTelemetryReplay : public TSharedFromThis<FImPlotTelemetryReplay, ESPMode::ThreadSafe>
+{
+public:
+
+	static TSharedPtr<FImPlotTelemetryReplay, ESPMode::ThreadSafe> Open(const FString& Filename, int32 MaxCachedChunks = 256);
+
+	bool IsReady() const { return bReady; }
+	bool HasFailed() const { return bFailed; }
+
+	TArray<FName> GetChannels() const;
+	FVector2D GetTimeRange() const;
+
+	// Fills #Out with the samples of #Channel with X in [TimeMin, TimeMax], at most #MaxPoints of them (<= 0 for all).
+	// Returns false while some of the needed chunks are still loading.
+	bool Fill(FName Channel, double TimeMin, double TimeMax, FScrollingBuffer& Out, int32 MaxPoints = 0);
+
+private:
+
+	struct FChunkInfo
+	{
+		int64 Offset = 0;
+		int32 NumSamples = 0;
+		int32 RawSize = 0;
+		int32 StoredSize = 0;
+		double XMin = 0.0;
+		double XMax = 0.0;
+	};
+
+	struct FDecodedChunk
+	{
+		TArray<float> X;
+		TArray<float> Y;
+		uint64 LastUsedFrame = 0;
+	};
+
+	FImPlotTelemetryReplay(const FString& InFilename, int32 InMaxCachedChunks);
+
+	void BuildIndex();
+	void RequestChunk(const FChunkInfo& Chunk);
+	void Trim();
+
+	FString Filename;
+	int32 MaxCachedChunks;
+	FThreadSafeBool bReady;
+	FThreadSafeBool bFailed;
+
+	// written once by the index task, read only after bReady
+	TMap<FName, TArray<FChunkInfo>> Index;
+	FVector2D TimeRange = FVector2D::ZeroVector;
+
+	// guards Cache and Loading
+	mutable FCriticalSection CacheLock;
+	TMap<int64, TSharedPtr<FDecodedChunk, ESPMode::ThreadSafe>> Cache;
+	TSet<int64> Loading;
+
+	// guards Reader, shared by the load tasks
+	FCriticalSection ReaderLock;
+	TUniquePtr<FArchive> Reader;
+};
+
+// Blueprint handle to a recorder. Copies of the struct share the same recorder.
+USTRUCT(BlueprintType)
+struct FImPlotTelemetryRecording
+{
+	GENERATED_BODY()
+
+	TSharedPtr<FImPlotTelemetryRecorder> Recorder;
+
+	bool IsValid() const { return Recorder.IsValid(); }
+};
+
+// Blueprint handle to a replay. Copies of the struct share the same replay.
+USTRUCT(BlueprintType)
+struct FImPlotTelemetryPlayback
+{
+	GENERATED_BODY()
+
+	TSharedPtr<FImPlotTelemetryReplay, ESPMode::ThreadSafe> Replay;
+
+	bool IsValid() const { return Replay.IsValid(); }
+};
+
+/*
+ *
+ */
+UCLASS()
+class IMGUI_API UImPlotTelemetryFunction : public UBlueprintFunctionLibrary
+{
+	GENERATED_BODY()
+
+public:
+
+	// Starts recording to #Filename (relative paths go to Saved/Telemetry). The file is opened on the writer thread.
+	UFUNCTION(BlueprintCallable, Category = "ImPlot|Telemetry", meta = (AdvancedDisplay = "2"))
+	static void StartTelemetryRecording(const FString& Filename, FImPlotTelemetryRecording& Recording, int32 ChunkSamples = 4096, int32 MaxPendingChunks = 64)
+	{
+		Recording.Recorder = MakeShared<FImPlotTelemetryRecorder>(ResolvePath(Filename), ChunkSamples, MaxPendingChunks);
+	}
+
+	// Flushes the remaining samples and closes the file once they are written, without waiting for them.
+	UFUNCTION(BlueprintCallable, Category = "ImPlot|Telemetry")
+	static void StopTelemetryRecording(UPARAM(ref) FImPlotTelemetryRecording& Recording)
+	{
+		if (Recording.IsValid())
+			Recording.Recorder->Stop();
+		Recording.Recorder.Reset();
+	}
+
+	UFUNCTION(BlueprintCallable, Category = "ImPlot|Telemetry")
+	static void RecordTelemetryPoint(const FImPlotTelemetryRecording& Recording, FName Channel, float x, float y)
+	{
+		if (Recording.IsValid())
+			Recording.Recorder->Record(Channel, x, y);
+	}
+
+	// Records the samples added to #buffer since the last call (the X values must grow).
+	UFUNCTION(BlueprintCallable, Category = "ImPlot|Telemetry")
+	static void RecordScrollingBuffer(const FImPlotTelemetryRecording& Recording, FName Channel, const FScrollingBuffer& buffer)
+	{
+		if (Recording.IsValid())
+			Recording.Recorder->RecordScrollingBuffer(Channel, buffer);
+	}
+
+	// Records the samples added to #buffer since the last call. Call it at least once per span.
+	UFUNCTION(BlueprintCallable, Category = "ImPlot|Telemetry")
+	static void RecordRollingBuffer(const FImPlotTelemetryRecording& Recording, FName Channel, const FRollingBuffer& buffer)
+	{
+		if (Recording.IsValid())
+			Recording.Recorder->RecordRollingBuffer(Channel, buffer);
+	}
+
+	// #Dropped counts chunks that were discarded because the disk could not keep up.
+	UFUNCTION(BlueprintPure, Category = "ImPlot|Telemetry")
+	static void GetTelemetryRecordingStats(const FImPlotTelemetryRecording& Recording, int32& Written, int32& Pending, int32& Dropped, bool& Failed)
+	{
+		Written = Recording.IsValid() ? Recording.Recorder->GetWrittenChunks() : 0;
+		Pending = Recording.IsValid() ? Recording.Recorder->GetPendingChunks() : 0;
+		Dropped = Recording.IsValid() ? Recording.Recorder->GetDroppedChunks() : 0;
+		Failed = Recording.IsValid() && Recording.Recorder->HasFailed();
+	}
+
+	// Opens a telemetry file for replay (relative paths are looked up in Saved/Telemetry). The file is indexed in the background.
+	UFUNCTION(BlueprintCallable, Category = "ImPlot|Telemetry", meta = (AdvancedDisplay = "2"))
+	static void OpenTelemetryReplay(const FString& Filename, FImPlotTelemetryPlayback& Playback, int32 MaxCachedChunks = 256)
+	{
+		Playback.Replay = FImPlotTelemetryReplay::Open(ResolvePath(Filename), MaxCachedChunks);
+	}
+
+	UFUNCTION(BlueprintCallable, Category = "ImPlot|Telemetry")
+	static void CloseTelemetryReplay(UPARAM(ref) FImPlotTelemetryPlayback& Playback) { Playback.Replay.Reset(); }
+
+	// #Ready is false while the file is still being indexed.
+	UFUNCTION(BlueprintPure, Category = "ImPlot|Telemetry")
+	static void GetTelemetryReplayInfo(const FImPlotTelemetryPlayback& Playback, bool& Ready, TArray<FName>& Channels, FVector2D& TimeRange)
+	{
+		Ready = Playback.IsValid() && Playback.Replay->IsReady();
+		Channels = Ready ? Playback.Replay->GetChannels() : TArray<FName>();
+		TimeRange = Ready ? Playback.Replay->GetTimeRange() : FVector2D::ZeroVector;
+	}
+
+	// Fills #buffer with the samples of #Channel in [time - history, time], so it can be drawn with the regular plot nodes.
+	// Move #time to seek or scrub. Returns false while chunks of the window are still loading.
+	UFUNCTION(BlueprintCallable, Category = "ImPlot|Telemetry", meta = (AdvancedDisplay = "5"))
+	static bool ReplayFillScrollingBuffer(const FImPlotTelemetryPlayback& Playback, FName Channel, float time, float history, UPARAM(ref) FScrollingBuffer& buffer, int32 max_points = 0)
+	{
+		if (!Playback.IsValid())
+			return false;
+		return Playback.Replay->Fill(Channel, time - history, time, buffer, max_points);
+	}
+
+private:
+
+	static FString ResolvePath(const FString& Filename)
+	{
+		return FPaths::IsRelative(Filename) ? FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("Telemetry"), Filename) : Filename;
+	}
+};
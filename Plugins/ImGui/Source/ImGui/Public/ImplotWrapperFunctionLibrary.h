@@ -8,6 +8,10 @@
 
 #include "ImGuiModule.h"
 #include "ImGuiWrapperFunctionLibrary.h"
+#include "ImplotCache.h"
+#include "ImplotColormapLut.h"
+#include "ImplotRunningStats.h"
+#include "ImplotSoACache.h"
 #include "ImplotWrapperFunctionLibrary.generated.h"
 
 DECLARE_DYNAMIC_DELEGATE_TwoParams(FFunctionDelegateFloat, int32, index, FVector2D&, point);
@@ -321,6 +325,10 @@ struct FNormalDistribution
 	UPROPERTY(EditAnywhere, BlueprintReadWrite)
 	int32 count = 10000;
 
+	// the same seed and count always produce the same samples
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	int32 Seed = 0;
+
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
 	TArray<float> Data;
 };
@@ -333,16 +341,22 @@ struct FScrollingBuffer
 	GENERATED_USTRUCT_BODY()
 
 	UPROPERTY(EditAnywhere, BlueprintReadWrite)
-	int MaxSize;
+	int MaxSize = 2000;
 
 	UPROPERTY(EditAnywhere, BlueprintReadWrite)
-	int Offset;
+	int Offset = 0;
 
 	UPROPERTY(EditAnywhere, BlueprintReadWrite)
 	TArray<float> DataX;
 
 	UPROPERTY(EditAnywhere, BlueprintReadWrite)
 	TArray<float> DataY;
+
+	// Statistics of the samples in the buffer, kept up to date by AddPoint and Erase. Rebuilt on access if the
+	// arrays were resized or edited from outside, as far as the sampled fingerprint of the arrays can tell.
+	mutable FImPlotRunningStats StatsX;
+	mutable FImPlotRunningStats StatsY;
+	mutable uint32 StatsFingerprint = 0;
 	
 	void Initialized(int max_size = 2000) {
 		check(DataX.Num() == 0)
@@ -350,18 +364,34 @@ struct FScrollingBuffer
 		Offset  = 0;
 		DataX.Empty(MaxSize);
 		DataY.Empty(MaxSize);
+		RebuildStats();
 	}
 	void AddPoint(float x, float y) {
+		EnsureStats();
+		PushPoint(x, y);
+		StatsFingerprint = GetFingerprint();
+	}
+	void AddPoints(const float* xs, const float* ys, int32 count) {
+		EnsureStats();
+		for (int32 i = 0; i < count; ++i)
+			PushPoint(xs[i], ys[i]);
+		StatsFingerprint = GetFingerprint();
+	}
+	void PushPoint(float x, float y) {
 		if (DataX.Num() < MaxSize)
 		{
 			DataX.Add(x);
 			DataY.Add(y);
 		}
 		else {
+			StatsX.Pop(DataX[Offset]);
+			StatsY.Pop(DataY[Offset]);
 			DataX[Offset] = x;
 			DataY[Offset] = y;
 			Offset =  (Offset + 1) % MaxSize;
 		}
+		StatsX.Push(x);
+		StatsY.Push(y);
 	}
 	void Erase() {
 		if (DataX.Num() > 0) {
@@ -369,9 +399,54 @@ struct FScrollingBuffer
 			DataY.Reset(0);
 			Offset  = 0;
 		}
+		RebuildStats();
+	}
+	uint32 GetFingerprint() const {
+		return HashCombine(GetTypeHash(Offset), HashCombine(ImPlotCache::SampleFingerprint(DataX.GetData(), DataX.Num()), ImPlotCache::SampleFingerprint(DataY.GetData(), DataY.Num())));
+	}
+	void EnsureStats() const {
+		if (StatsX.Num() != DataX.Num() || StatsY.Num() != DataY.Num() || StatsFingerprint != GetFingerprint())
+			RebuildStats();
+	}
+	void RebuildStats() const {
+		StatsX.Reset();
+		StatsY.Reset();
+		const int32 Num = FMath::Min(DataX.Num(), DataY.Num());
+		// oldest sample first: once the ring is full it starts at Offset
+		const int32 Start = Num < MaxSize || Num == 0 ? 0 : Offset % Num;
+		for (int32 k = 0; k < Num; ++k) {
+			const int32 i = (Start + k) % Num;
+			StatsX.Push(DataX[i]);
+			StatsY.Push(DataY[i]);
+		}
+		StatsFingerprint = GetFingerprint();
 	}
 };
 
+// Sets the next plot limits to the extents in #X and #Y, padded by #Padding of their size on each side. O(1).
+inline void SetNextPlotLimitsFromStats(const FImPlotRunningStats& X, const FImPlotRunningStats& Y, float Padding, int32 Cond, bool bFitX, bool bFitY, int32 YAxis)
+{
+	auto Padded = [Padding](const FImPlotRunningStats& Stats, double& Min, double& Max)
+	{
+		const double Size = (double)Stats.GetMax() - Stats.GetMin();
+		const double Pad = Size > 0.0 ? Size * Padding : 0.5;
+		Min = Stats.GetMin() - Pad;
+		Max = Stats.GetMax() + Pad;
+	};
+
+	double Min, Max;
+	if (bFitX && X.Num() > 0)
+	{
+		Padded(X, Min, Max);
+		ImPlot::SetNextPlotLimitsX(Min, Max, Cond);
+	}
+	if (bFitY && Y.Num() > 0)
+	{
+		Padded(Y, Min, Max);
+		ImPlot::SetNextPlotLimitsY(Min, Max, Cond, YAxis);
+	}
+}
+
 /*
 * 
 */
@@ -398,6 +473,24 @@ public:
 	{
 		buffer.Erase();
 	}
+
+	// Min, max, mean and variance of the samples in the buffer, without looping over them.
+	UFUNCTION(BlueprintPure, Category="ImPlot|ScrollingBuffer")
+	static void GetScrollingBufferStats(const FScrollingBuffer& buffer, FImPlotSeriesStats& x, FImPlotSeriesStats& y)
+	{
+		buffer.EnsureStats();
+		x = buffer.StatsX;
+		y = buffer.StatsY;
+	}
+
+	// Fits the next plot to the buffer from its running statistics, instead of FitNextPlotAxes scanning every point.
+	// Call right before BeginPlot(). ImGuiCond_Always (1) follows the data every frame but locks the axes.
+	UFUNCTION(BlueprintCallable, Category="ImPlot|ScrollingBuffer", meta = (AdvancedDisplay = "2"))
+	static void SetNextPlotLimitsFromScrollingBuffer(const FScrollingBuffer& buffer, float padding = 0.05f, int32 ImGuiCond = 1/*ImGuiCond_Always*/, bool x = true, bool y = true, EImPlotYAxis y_axis = EImPlotYAxis::ImPlotYAxis_1)
+	{
+		buffer.EnsureStats();
+		SetNextPlotLimitsFromStats(buffer.StatsX, buffer.StatsY, padding, ImGuiCond, x, y, ToInt32(y_axis));
+	}
 };
 
 
@@ -415,23 +508,52 @@ struct FRollingBuffer
 
 	UPROPERTY(EditAnywhere, BlueprintReadWrite)
 	TArray<float> DataY;
+
+	// Statistics of the current span, kept up to date by AddPoint. Rebuilt on access if the arrays were resized or
+	// edited from outside, as far as the sampled fingerprint of the arrays can tell.
+	mutable FImPlotRunningStats StatsX;
+	mutable FImPlotRunningStats StatsY;
+	mutable uint32 StatsFingerprint = 0;
 	
 	void Initialized(float InSpan = 10.0f, int32 size = 2000) {
 		check(DataX.Num() == 0)
 		Span = InSpan;
 		DataX.Empty(size);
 		DataY.Empty(size);
+		RebuildStats();
 	}
 	void AddPoint(float x, float y) {
+		EnsureStats();
 		float xmod = fmodf(x, Span);
 		if (DataX.Num() > 0 && xmod < DataX[DataX.Num()-1])
 		{
 			DataX.Reset(0);
 			DataY.Reset(0);
+			StatsX.Reset();
+			StatsY.Reset();
 		}
 			
 		DataX.Add(xmod);
 		DataY.Add(y);
+		StatsX.Push(xmod);
+		StatsY.Push(y);
+		StatsFingerprint = GetFingerprint();
+	}
+	uint32 GetFingerprint() const {
+		return HashCombine(ImPlotCache::SampleFingerprint(DataX.GetData(), DataX.Num()), ImPlotCache::SampleFingerprint(DataY.GetData(), DataY.Num()));
+	}
+	void EnsureStats() const {
+		if (StatsX.Num() != DataX.Num() || StatsY.Num() != DataY.Num() || StatsFingerprint != GetFingerprint())
+			RebuildStats();
+	}
+	void RebuildStats() const {
+		StatsX.Reset();
+		StatsY.Reset();
+		for (int32 i = 0; i < FMath::Min(DataX.Num(), DataY.Num()); ++i) {
+			StatsX.Push(DataX[i]);
+			StatsY.Push(DataY[i]);
+		}
+		StatsFingerprint = GetFingerprint();
 	}
 };
 
@@ -455,6 +577,23 @@ public:
 	{
 		buffer.AddPoint(x, y);
 	}
+
+	// Min, max, mean and variance of the current span, without looping over the samples.
+	UFUNCTION(BlueprintPure, Category="ImPlot|RollingBuffer")
+	static void GetRollingBufferStats(const FRollingBuffer& buffer, FImPlotSeriesStats& x, FImPlotSeriesStats& y)
+	{
+		buffer.EnsureStats();
+		x = buffer.StatsX;
+		y = buffer.StatsY;
+	}
+
+	// Fits the next plot to the current span from its running statistics. The X axis usually stays at [0, Span].
+	UFUNCTION(BlueprintCallable, Category="ImPlot|RollingBuffer", meta = (AdvancedDisplay = "2"))
+	static void SetNextPlotLimitsFromRollingBuffer(const FRollingBuffer& buffer, float padding = 0.05f, int32 ImGuiCond = 1/*ImGuiCond_Always*/, bool x = false, bool y = true, EImPlotYAxis y_axis = EImPlotYAxis::ImPlotYAxis_1)
+	{
+		buffer.EnsureStats();
+		SetNextPlotLimitsFromStats(buffer.StatsX, buffer.StatsY, padding, ImGuiCond, x, y, ToInt32(y_axis));
+	}
 };
 
 // Huge data used by Time Formatting example (~500 MB allocation!)
@@ -1397,11 +1536,20 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Implot|Item")
 	static void PlotImage(const FString& label_id, UTexture2D* user_texture_id, FVector2D bounds_min, FVector2D bounds_max, FVector2D uv0, FVector2D uv1, UPARAM(ref) FLinearColor& tint_col)
 	{
-		FImGuiTextureHandle handle = FImGuiModule::Get().FindTextureHandle(user_texture_id->GetFName());
+		const FImGuiTextureHandle handle = FImGuiTextureCache::Get().FindOrRegister(user_texture_id);
 		if(!handle.IsValid())
-		{
-			handle = FImGuiModule::Get().RegisterTexture(user_texture_id->GetFName(), user_texture_id);
-		}
+			return;
+
+		ImPlot::PlotImage(TCHAR_TO_ANSI(*label_id), handle, ToImPlotPoint(bounds_min), ToImPlotPoint(bounds_max), ToImVec2(uv0), ToImVec2(uv1), ToImVec4(tint_col));
+	}
+
+	// same as PlotImage, but with a texture resolved by MakeImGuiTexture (no lookup per frame)
+	UFUNCTION(BlueprintCallable, Category = "Implot|Item")
+	static void PlotImageCached(const FString& label_id, UPARAM(ref) FImGuiTexture& texture, FVector2D bounds_min, FVector2D bounds_max, FVector2D uv0 = FVector2D(0,0), FVector2D uv1 = FVector2D(1,1), FLinearColor tint_col = FLinearColor(1,1,1,1))
+	{
+		const FImGuiTextureHandle& handle = FImGuiTextureCache::Get().Resolve(texture);
+		if(!handle.IsValid())
+			return;
 
 		ImPlot::PlotImage(TCHAR_TO_ANSI(*label_id), handle, ToImPlotPoint(bounds_min), ToImPlotPoint(bounds_max), ToImVec2(uv0), ToImVec2(uv1), ToImVec4(tint_col));
 	}
@@ -1844,13 +1992,17 @@ public:
 	// Temporarily switch to one of the built-in colormaps.
 	UFUNCTION(BlueprintCallable, Category = "Implot|Colormaps")
 	static void PushColormap(UPARAM(meta=(Bitmask, BitmaskEnum=EImPlotColormap)) int32 cmap)
-	{ ImPlot::PushColormap(cmap); }
+	{
+		ImPlot::PushColormap(cmap);
+		FImPlotColormapLut::Prepare(cmap);
+	}
 	
 	// Temporarily switch to your custom colormap. The pointer data must persist until the matching call to PopColormap!
 	UFUNCTION(BlueprintCallable, Category = "Implot|Colormaps")
 	static void PushColormapA(const FString& colorName)
 	{
 		ImPlot::PushColormap(TCHAR_TO_ANSI(*colorName));
+		FImPlotColormapLut::Prepare();
 	}
 	
 	// Undo temporary colormap modification.
@@ -1885,6 +2037,26 @@ public:
 	static FLinearColor SampleColormap(float t, UPARAM(meta=(Bitmask, BitmaskEnum=EImPlotColormap)) int32 cmap = -1)
 	{ return ToLinearColor(ImPlot::SampleColormap(t, cmap)); }
 
+	// Batch version of SampleColormap: maps every value from [scale_min, scale_max] to a color of #cmap through a lookup table.
+	// #high_res uses a 1024 entry table instead of 256 entries. Values outside the range are clamped.
+	UFUNCTION(BlueprintCallable, Category = "Implot|Colormaps", meta = (AdvancedDisplay = "4"))
+	static void SampleColormapBatch(const TArray<float>& values, TArray<FColor>& colors, float scale_min = 0.0f, float scale_max = 1.0f,
+		UPARAM(meta=(Bitmask, BitmaskEnum=EImPlotColormap)) int32 cmap = -1, bool high_res = false)
+	{
+		colors.SetNumUninitialized(values.Num());
+		FImPlotColormapLut::Sample(values.GetData(), values.Num(), scale_min, scale_max, colors.GetData(), cmap,
+			high_res ? FImPlotColormapLut::HighResSize : FImPlotColormapLut::DefaultSize);
+	}
+
+	// Same as SampleColormapBatch, with linear colors.
+	UFUNCTION(BlueprintCallable, Category = "Implot|Colormaps", meta = (AdvancedDisplay = "4"))
+	static void SampleColormapBatchLinear(const TArray<float>& values, TArray<FLinearColor>& colors, float scale_min = 0.0f, float scale_max = 1.0f,
+		UPARAM(meta=(Bitmask, BitmaskEnum=EImPlotColormap)) int32 cmap = -1, bool high_res = false)
+	{
+		colors.SetNumUninitialized(values.Num());
+		FImPlotColormapLut::Sample(values.GetData(), values.Num(), scale_min, scale_max, colors.GetData(), cmap,
+			high_res ? FImPlotColormapLut::HighResSize : FImPlotColormapLut::DefaultSize);
+	}
 	 
 	// Shows a vertical color scale with linear spaced ticks using the specified color map. Use double hashes to hide label (e.g. "##NoLabel").
 	UFUNCTION(BlueprintCallable, Category = "Implot|Colormaps")
@@ -2022,38 +2194,54 @@ class IMGUI_API UImplotWrapperVectorFunctionLibrary : public UBlueprintFunctionL
 
 public:
 		
-	// Plots a standard 2D line plot.
+	// Plots a standard 2D line plot. With a #data_version (>= 0, bumped whenever #values changes), large arrays are plotted
+	// from a cached per component copy; the default -1 plots #values in place. Same for the other vector plots.
 	UFUNCTION(BlueprintCallable, Category = "Implot|Item", meta = (AdvancedDisplay = "4", DisplayName = "Plotine Vector"))
-	static void PlotLine(const FString& label_id_x, const FString& label_id_y, const FString& label_id_z, const TArray<FVector>& values, int32 count = -1, float xscale = 1.0f, float x0 = 0.0f, float y0 = 0.0f, float z0 = 0.0f)
+	static void PlotLine(const FString& label_id_x, const FString& label_id_y, const FString& label_id_z, const TArray<FVector>& values, int32 count = -1, float xscale = 1.0f, float x0 = 0.0f, float y0 = 0.0f, float z0 = 0.0f, int32 data_version = -1)
 	{
+		const FImPlotSoAView View = FImPlotSoACache::Get(values, data_version);
+		const int32 Count = count == -1 ? View.Num : FMath::Min(count, View.Num);
 		if(label_id_x.Len() > 0)
-			ImPlot::PlotLine<float>(TCHAR_TO_ANSI(*label_id_x), reinterpret_cast<const float*>(values.GetData())+0, count == -1 ? values.Num() : count, xscale, x0, 0, sizeof(FVector));
+			ImPlot::PlotLine<float>(TCHAR_TO_ANSI(*label_id_x), View.X, Count, xscale, x0, 0, View.Stride);
 		if(label_id_y.Len() > 0)
-			ImPlot::PlotLine<float>(TCHAR_TO_ANSI(*label_id_y), reinterpret_cast<const float*>(values.GetData())+1, count == -1 ? values.Num() : count, xscale, y0, 0, sizeof(FVector));
+			ImPlot::PlotLine<float>(TCHAR_TO_ANSI(*label_id_y), View.Y, Count, xscale, y0, 0, View.Stride);
 		if(label_id_z.Len() > 0)
-			ImPlot::PlotLine<float>(TCHAR_TO_ANSI(*label_id_z), reinterpret_cast<const float*>(values.GetData())+2, count == -1 ? values.Num() : count, xscale, z0, 0, sizeof(FVector));
+			ImPlot::PlotLine<float>(TCHAR_TO_ANSI(*label_id_z), View.Z, Count, xscale, z0, 0, View.Stride);
 	}
 	
 	UFUNCTION(BlueprintCallable, Category = "Implot|Item", meta = (AdvancedDisplay = "4", DisplayName = "PlotScatter Vector"))
-	static void PlotScatter(const FString& label_id_x, const FString& label_id_y, const FString& label_id_z, const TArray<FVector>& values, int32 count = -1, float xscale = 1.0f, float x0 = 0.0f, float y0 = 0.0f, float z0 = 0.0f, int32 offset = 0)
+	static void PlotScatter(const FString& label_id_x, const FString& label_id_y, const FString& label_id_z, const TArray<FVector>& values, int32 count = -1, float xscale = 1.0f, float x0 = 0.0f, float y0 = 0.0f, float z0 = 0.0f, int32 offset = 0, int32 data_version = -1)
 	{
+		const FImPlotSoAView View = FImPlotSoACache::Get(values, data_version);
+		const int32 Count = count == -1 ? View.Num : FMath::Min(count, View.Num);
 		if(label_id_x.Len() > 0)
-			ImPlot::PlotScatter<float>(TCHAR_TO_ANSI(*label_id_x), reinterpret_cast<const float*>(values.GetData())+0, count == -1 ? values.Num() : count, xscale, x0, offset, sizeof(FVector));
+			ImPlot::PlotScatter<float>(TCHAR_TO_ANSI(*label_id_x), View.X, Count, xscale, x0, offset, View.Stride);
 		if(label_id_y.Len() > 0)
-			ImPlot::PlotScatter<float>(TCHAR_TO_ANSI(*label_id_y), reinterpret_cast<const float*>(values.GetData())+1, count == -1 ? values.Num() : count, xscale, y0, offset, sizeof(FVector));
+			ImPlot::PlotScatter<float>(TCHAR_TO_ANSI(*label_id_y), View.Y, Count, xscale, y0, offset, View.Stride);
 		if(label_id_z.Len() > 0)
-			ImPlot::PlotScatter<float>(TCHAR_TO_ANSI(*label_id_z), reinterpret_cast<const float*>(values.GetData())+2, count == -1 ? values.Num() : count, xscale, z0, offset, sizeof(FVector));
+			ImPlot::PlotScatter<float>(TCHAR_TO_ANSI(*label_id_z), View.Z, Count, xscale, z0, offset, View.Stride);
 	}
 
 	UFUNCTION(BlueprintCallable, Category = "Implot|Item", meta = (AdvancedDisplay = "4", DisplayName = "PlotStairs Vector"))
-	static void PlotStairs(const FString& label_id_x, const FString& label_id_y, const FString& label_id_z, const TArray<FVector>& values, int32 count = -1, float xscale = 1.0f, float x0 = 0.0f, float y0 = 0.0f, float z0 = 0.0f, int32 offset = 0)
+	static void PlotStairs(const FString& label_id_x, const FString& label_id_y, const FString& label_id_z, const TArray<FVector>& values, int32 count = -1, float xscale = 1.0f, float x0 = 0.0f, float y0 = 0.0f, float z0 = 0.0f, int32 offset = 0, int32 data_version = -1)
 	{
+		const FImPlotSoAView View = FImPlotSoACache::Get(values, data_version);
+		const int32 Count = count == -1 ? View.Num : FMath::Min(count, View.Num);
 		if(label_id_x.Len() > 0)
-			ImPlot::PlotStairs<float>(TCHAR_TO_ANSI(*label_id_x), reinterpret_cast<const float*>(values.GetData())+0, count == -1 ? values.Num() : count, xscale, x0, offset, sizeof(FVector));
+			ImPlot::PlotStairs<float>(TCHAR_TO_ANSI(*label_id_x), View.X, Count, xscale, x0, offset, View.Stride);
 		if(label_id_y.Len() > 0)
-			ImPlot::PlotStairs<float>(TCHAR_TO_ANSI(*label_id_y), reinterpret_cast<const float*>(values.GetData())+1, count == -1 ? values.Num() : count, xscale, y0, offset, sizeof(FVector));
+			ImPlot::PlotStairs<float>(TCHAR_TO_ANSI(*label_id_y), View.Y, Count, xscale, y0, offset, View.Stride);
 		if(label_id_z.Len() > 0)
-			ImPlot::PlotStairs<float>(TCHAR_TO_ANSI(*label_id_z), reinterpret_cast<const float*>(values.GetData())+2, count == -1 ? values.Num() : count, xscale, z0, offset, sizeof(FVector));
+			ImPlot::PlotStairs<float>(TCHAR_TO_ANSI(*label_id_z), View.Z, Count, xscale, z0, offset, View.Stride);
+	}
+
+	// Component wise min and max of #values, taken from the cached per component copy when #data_version is given.
+	UFUNCTION(BlueprintPure, Category = "Implot|Item", meta = (DisplayName = "Get Bounds Vector"))
+	static void GetBounds(const TArray<FVector>& values, FVector& min, FVector& max, int32 data_version = -1)
+	{
+		const FImPlotSoAView View = FImPlotSoACache::Get(values, data_version);
+		min = View.Min;
+		max = View.Max;
 	}
 };
 
@@ -2069,46 +2257,67 @@ class IMGUI_API UImplotWrapperVector2DFunctionLibrary : public UBlueprintFunctio
 public:
 
 	UFUNCTION(BlueprintCallable, Category = "Implot|Item", meta = (AdvancedDisplay = "3", DisplayName = "PlotLine Vector2D(values"))
-	static void PlotLine(const FString& label_id, const TArray<FVector2D>& values, int32 count = -1, int32 offset = 0)
+	static void PlotLine(const FString& label_id, const TArray<FVector2D>& values, int32 count = -1, int32 offset = 0, int32 data_version = -1)
 	{
-		ImPlot::PlotLine<float>(TCHAR_TO_ANSI(*label_id), reinterpret_cast<const float*>(values.GetData())+0, reinterpret_cast<const float*>(values.GetData())+1
-		, count == -1 ? values.Num() : count, offset, sizeof(FVector2D));
+		const FImPlotSoAView View = FImPlotSoACache::Get(values, data_version);
+		const int32 Count = count == -1 ? View.Num : FMath::Min(count, View.Num);
+		ImPlot::PlotLine<float>(TCHAR_TO_ANSI(*label_id), View.X, View.Y
+		, Count, offset, View.Stride);
 	}
 	
 	UFUNCTION(BlueprintCallable, Category = "Implot|Item", meta = (AdvancedDisplay = "3", DisplayName = "PlotLine Vector2D(x,y)"))
-	static void PlotLineB(const FString& label_id_x, const FString& label_id_y, const TArray<FVector2D>& values, int32 count = -1, float xscale = 1.0f, float x0 = 0.0f, float y0 = 0.0f)
+	static void PlotLineB(const FString& label_id_x, const FString& label_id_y, const TArray<FVector2D>& values, int32 count = -1, float xscale = 1.0f, float x0 = 0.0f, float y0 = 0.0f, int32 data_version = -1)
 	{
+		const FImPlotSoAView View = FImPlotSoACache::Get(values, data_version);
+		const int32 Count = count == -1 ? View.Num : FMath::Min(count, View.Num);
 		if(label_id_x.Len() > 0)
-			ImPlot::PlotLine<float>(TCHAR_TO_ANSI(*label_id_x), reinterpret_cast<const float*>(values.GetData())+0, count == -1 ? values.Num() : count, xscale, x0, 0, sizeof(FVector2D));
+			ImPlot::PlotLine<float>(TCHAR_TO_ANSI(*label_id_x), View.X, Count, xscale, x0, 0, View.Stride);
 		if(label_id_y.Len() > 0)
-			ImPlot::PlotLine<float>(TCHAR_TO_ANSI(*label_id_y), reinterpret_cast<const float*>(values.GetData())+1, count == -1 ? values.Num() : count, xscale, y0, 0, sizeof(FVector2D));
+			ImPlot::PlotLine<float>(TCHAR_TO_ANSI(*label_id_y), View.Y, Count, xscale, y0, 0, View.Stride);
 	}
 
 	UFUNCTION(BlueprintCallable, Category = "Implot|Item", meta = (AdvancedDisplay = "3", DisplayName = "PlotScatter Vector2D(values"))
-	static void PlotScatter(const FString& label_id, const TArray<FVector2D>& values, int32 count = -1, int32 offset = 0)
+	static void PlotScatter(const FString& label_id, const TArray<FVector2D>& values, int32 count = -1, int32 offset = 0, int32 data_version = -1)
 	{
-		ImPlot::PlotScatter<float>(TCHAR_TO_ANSI(*label_id), reinterpret_cast<const float*>(values.GetData())+0, reinterpret_cast<const float*>(values.GetData())+1
-		, count == -1 ? values.Num() : count, offset, sizeof(FVector2D));
+		const FImPlotSoAView View = FImPlotSoACache::Get(values, data_version);
+		const int32 Count = count == -1 ? View.Num : FMath::Min(count, View.Num);
+		ImPlot::PlotScatter<float>(TCHAR_TO_ANSI(*label_id), View.X, View.Y
+		, Count, offset, View.Stride);
 	}
 	
 	UFUNCTION(BlueprintCallable, Category = "Implot|Item", meta = (AdvancedDisplay = "3", DisplayName = "PlotScatter Vector2D(x,y)"))
-	static void PlotScatterB(const FString& label_id_x, const FString& label_id_y, const TArray<FVector2D>& values, int32 count = -1, float xscale = 1.0f, float x0 = 0.0f, float y0 = 0.0f, int32 offset = 0)
+	static void PlotScatterB(const FString& label_id_x, const FString& label_id_y, const TArray<FVector2D>& values, int32 count = -1, float xscale = 1.0f, float x0 = 0.0f, float y0 = 0.0f, int32 offset = 0, int32 data_version = -1)
 	{
-		ImPlot::PlotScatter<float>(TCHAR_TO_ANSI(*label_id_x), reinterpret_cast<const float*>(values.GetData())+0, count == -1 ? values.Num() : count, xscale, x0, offset, sizeof(FVector2D));
-		ImPlot::PlotScatter<float>(TCHAR_TO_ANSI(*label_id_y), reinterpret_cast<const float*>(values.GetData())+1, count == -1 ? values.Num() : count, xscale, y0, offset, sizeof(FVector2D));
+		const FImPlotSoAView View = FImPlotSoACache::Get(values, data_version);
+		const int32 Count = count == -1 ? View.Num : FMath::Min(count, View.Num);
+		ImPlot::PlotScatter<float>(TCHAR_TO_ANSI(*label_id_x), View.X, Count, xscale, x0, offset, View.Stride);
+		ImPlot::PlotScatter<float>(TCHAR_TO_ANSI(*label_id_y), View.Y, Count, xscale, y0, offset, View.Stride);
 	}
 
 	UFUNCTION(BlueprintCallable, Category = "Implot|Item", meta = (AdvancedDisplay = "3", DisplayName = "PlotStairs Vector2D(values)"))
-	static void PlotStairs(const FString& label_id, const TArray<FVector2D>& values, int32 count = -1, float xscale = 1.0f, int32 offset = 0)
+	static void PlotStairs(const FString& label_id, const TArray<FVector2D>& values, int32 count = -1, float xscale = 1.0f, int32 offset = 0, int32 data_version = -1)
 	{
-		ImPlot::PlotStairs<float>(TCHAR_TO_ANSI(*label_id), reinterpret_cast<const float*>(values.GetData())+0, reinterpret_cast<const float*>(values.GetData())+1
-			, count == -1 ? values.Num() : count, offset, sizeof(FVector2D));
+		const FImPlotSoAView View = FImPlotSoACache::Get(values, data_version);
+		const int32 Count = count == -1 ? View.Num : FMath::Min(count, View.Num);
+		ImPlot::PlotStairs<float>(TCHAR_TO_ANSI(*label_id), View.X, View.Y
+			, Count, offset, View.Stride);
 	}
 	
 	UFUNCTION(BlueprintCallable, Category = "Implot|Item", meta = (AdvancedDisplay = "3", DisplayName = "PlotStairs Vector2D(x,y)"))
-	static void PlotStairsB(const FString& label_id_x, const FString& label_id_y, const TArray<FVector2D>& values, int32 count = -1, float xscale = 1.0f, float x0 = 0.0f, float y0 = 0.0f, int32 offset = 0)
+	static void PlotStairsB(const FString& label_id_x, const FString& label_id_y, const TArray<FVector2D>& values, int32 count = -1, float xscale = 1.0f, float x0 = 0.0f, float y0 = 0.0f, int32 offset = 0, int32 data_version = -1)
+	{
+		const FImPlotSoAView View = FImPlotSoACache::Get(values, data_version);
+		const int32 Count = count == -1 ? View.Num : FMath::Min(count, View.Num);
+		ImPlot::PlotStairs<float>(TCHAR_TO_ANSI(*label_id_x), View.X, Count, xscale, x0, offset, View.Stride);
+		ImPlot::PlotStairs<float>(TCHAR_TO_ANSI(*label_id_y), View.Y, Count, xscale, y0, offset, View.Stride);
+	}
+
+	// Same as Get Bounds Vector, for FVector2D arrays.
+	UFUNCTION(BlueprintPure, Category = "Implot|Item", meta = (DisplayName = "Get Bounds Vector2D"))
+	static void GetBounds(const TArray<FVector2D>& values, FVector2D& min, FVector2D& max, int32 data_version = -1)
 	{
-		ImPlot::PlotStairs<float>(TCHAR_TO_ANSI(*label_id_x), reinterpret_cast<const float*>(values.GetData())+0, count == -1 ? values.Num() : count, xscale, x0, offset, sizeof(FVector2D));
-		ImPlot::PlotStairs<float>(TCHAR_TO_ANSI(*label_id_y), reinterpret_cast<const float*>(values.GetData())+1, count == -1 ? values.Num() : count, xscale, y0, offset, sizeof(FVector2D));
+		const FImPlotSoAView View = FImPlotSoACache::Get(values, data_version);
+		min = FVector2D(View.Min);
+		max = FVector2D(View.Max);
 	}
 };